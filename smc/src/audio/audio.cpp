@@ -20,6 +20,8 @@
 #include "../user/preferences.h"
 #include "../core/i18n.h"
 #include "../core/filesystem/filesystem.h"
+#include "../core/filesystem/resource_manager.h"
+#include "../core/property_helper.h"
 
 namespace SMC
 {
@@ -40,6 +42,22 @@ void Finished_Sound( const int channel )
 	}
 }
 
+float Get_Distance_Volume_Factor( float distance, float reduction_begin, float reduction_end )
+{
+	// no reduction
+	if( distance <= reduction_begin )
+	{
+		return 1.0f;
+	}
+	// out of range
+	if( distance >= reduction_end )
+	{
+		return 0.0f;
+	}
+
+	return 1.0f - ( distance - reduction_begin ) / ( reduction_end - reduction_begin );
+}
+
 /* *** *** *** *** *** *** *** *** Audio Sound *** *** *** *** *** *** *** *** *** */
 
 cAudio_Sound :: cAudio_Sound( void )
@@ -47,6 +65,9 @@ cAudio_Sound :: cAudio_Sound( void )
 	m_data = NULL;
 	m_channel = -1;
 	m_resource_id = -1;
+	m_priority = SOUND_PRIORITY_MIN;
+	m_volume = 0;
+	m_start_time = 0;
 }
 
 cAudio_Sound :: ~cAudio_Sound( void )
@@ -72,6 +93,8 @@ void cAudio_Sound :: Free( void )
 	
 	m_channel = -1;
 	m_resource_id = -1;
+	m_priority = SOUND_PRIORITY_MIN;
+	m_volume = 0;
 }
 
 void cAudio_Sound :: Finished( void )
@@ -81,7 +104,15 @@ void cAudio_Sound :: Finished( void )
 
 int cAudio_Sound :: Play( int use_res_id /* = -1 */, int loops /* = 0 */ )
 {
-	if( !m_data || !m_data->m_chunk )
+	if( !m_data )
+	{
+		return 0;
+	}
+
+	// decode on the first play
+	Mix_Chunk *chunk = m_data->Get_Chunk();
+
+	if( !chunk )
 	{
 		return 0;
 	}
@@ -109,7 +140,7 @@ int cAudio_Sound :: Play( int use_res_id /* = -1 */, int loops /* = 0 */ )
 
 	m_resource_id = use_res_id;
 	// play sound
-	m_channel = Mix_PlayChannel( -1, m_data->m_chunk, loops );
+	m_channel = Mix_PlayChannel( -1, chunk, loops );
 	// add callback if sound finished playing
 	Mix_ChannelFinished( &Finished_Sound );
 
@@ -145,6 +176,12 @@ cAudio :: cAudio( void )
 	m_music_old = NULL;
 
 	m_max_sounds = 0;
+	m_sound_coalesce_time = 40;
+	m_sound_reduction_begin = 400.0f;
+	m_sound_reduction_end = 1000.0f;
+	m_sound_coalesced_count = 0;
+	m_sound_stolen_count = 0;
+	m_sound_dropped_count = 0;
 
 	m_audio_buffer = 4096; // below 2048 can be choppy
 	m_audio_channels = MIX_DEFAULT_CHANNELS; // 1 = Mono, 2 = Stereo
@@ -304,6 +341,19 @@ bool cAudio :: Init( void )
 
 void cAudio :: Close( void )
 {
+	// the background loaded sounds are not needed anymore
+	if( m_decode_thread.joinable() )
+	{
+		m_decode_thread.join();
+	}
+
+	for( SoundList::iterator itr = m_decoded_sounds.begin(); itr != m_decoded_sounds.end(); ++itr )
+	{
+		delete *itr;
+	}
+
+	m_decoded_sounds.clear();
+
 	if( m_initialised )
 	{
 		if( m_debug )
@@ -330,17 +380,21 @@ void cAudio :: Close( void )
 
 		if( m_music_enabled )
 		{
+			Finish_Music_Prefetch();
+			m_music_prefetch_filename.clear();
+			m_music_prefetch_data.clear();
+
 			Halt_Music();
 
 			if( m_music )
 			{
-				Mix_FreeMusic( m_music );
+				Free_Music( m_music );
 				m_music = NULL;
 			}
 
 			if( m_music_old )
 			{
-				Mix_FreeMusic( m_music_old );
+				Free_Music( m_music_old );
 				m_music_old = NULL;
 			}
 
@@ -437,7 +491,129 @@ cSound *cAudio :: Get_Sound_File( std::string filename ) const
 	return sound;
 }
 
+void cAudio :: Start_Sound_Decode( const vector<std::string> &filenames )
+{
+	Finish_Sound_Decode();
+
+	if( !m_initialised || !m_sound_enabled )
+	{
+		return;
+	}
+
+	// resolve the sound files here as the sound manager is not thread safe
+	vector<std::string> sound_files;
+
+	for( vector<std::string>::const_iterator itr = filenames.begin(); itr != filenames.end(); ++itr )
+	{
+		std::string filename = (*itr);
+
+		// not available
+		if( !File_Exists( filename ) )
+		{
+			// add sound directory
+			if( filename.find( DATA_DIR "/" GAME_SOUNDS_DIR "/" ) == std::string::npos )
+			{
+				filename.insert( 0, DATA_DIR "/" GAME_SOUNDS_DIR "/" );
+			}
+		}
+
+		// already cached
+		if( pSound_Manager->Get_Pointer( filename ) )
+		{
+			continue;
+		}
+
+		sound_files.push_back( filename );
+	}
+
+	m_decode_thread = boost::thread( &cAudio::Decode_Sounds, this, sound_files );
+}
+
+void cAudio :: Finish_Sound_Decode( void )
+{
+	if( !m_decode_thread.joinable() )
+	{
+		return;
+	}
+
+	m_decode_thread.join();
+
+	for( SoundList::iterator itr = m_decoded_sounds.begin(); itr != m_decoded_sounds.end(); ++itr )
+	{
+		cSound *sound = (*itr);
+
+		// loaded in the meantime
+		if( pSound_Manager->Get_Pointer( sound->m_filename ) )
+		{
+			delete sound;
+			continue;
+		}
+
+		pSound_Manager->Add( sound );
+
+		// decoded in the background
+		if( sound->m_chunk )
+		{
+			pSound_Manager->Add_Decoded( sound );
+		}
+
+		if( m_debug )
+		{
+			printf( "Loaded sound file : %s\n", sound->m_filename.c_str() );
+		}
+	}
+
+	m_decoded_sounds.clear();
+}
+
+void cAudio :: Decode_Sounds( const vector<std::string> &filenames )
+{
+	for( vector<std::string>::const_iterator itr = filenames.begin(); itr != filenames.end(); ++itr )
+	{
+		cSound *sound = new cSound();
+
+		// failed loading
+		if( !sound->Load( *itr ) )
+		{
+			printf( "Could not load sound file : %s \nReason : %s\n", itr->c_str(), SDL_GetError() );
+			delete sound;
+			continue;
+		}
+
+		// decode now instead of on the first play
+		sound->Decode();
+
+		m_decoded_sounds.push_back( sound );
+	}
+}
+
 bool cAudio :: Play_Sound( std::string filename, int res_id /* = -1 */, int volume /* = -1 */, int loops /* = 0 */ )
+{
+	return Play_Sound_Voice( filename, res_id, volume, loops, 1.0f );
+}
+
+bool cAudio :: Play_Sound_At( std::string filename, float pos_x, float pos_y, int res_id /* = -1 */, int volume /* = -1 */ )
+{
+	if( !m_initialised || !m_sound_enabled )
+	{
+		return 0;
+	}
+
+	// distance from the camera center position
+	const float dx = pActive_Camera->m_x + ( game_res_w * 0.5f ) - pos_x;
+	const float dy = pActive_Camera->m_y + ( game_res_h * 0.5f ) - pos_y;
+	const float volume_mod = Get_Distance_Volume_Factor( sqrt( dx * dx + dy * dy ), m_sound_reduction_begin, m_sound_reduction_end );
+
+	// not hearable
+	if( volume_mod <= 0.0f )
+	{
+		return 0;
+	}
+
+	return Play_Sound_Voice( filename, res_id, volume, 0, volume_mod );
+}
+
+bool cAudio :: Play_Sound_Voice( std::string filename, int res_id, int volume, int loops, float volume_mod )
 {
 	if( !m_initialised || !m_sound_enabled )
 	{
@@ -470,12 +646,61 @@ bool cAudio :: Play_Sound( std::string filename, int res_id /* = -1 */, int volu
 		return 0;
 	}
 
+	// volume is out of range
+	if( volume > MIX_MAX_VOLUME )
+	{
+		printf( "PlaySound Volume is out of range : %d\n", volume );
+		volume = m_sound_volume;
+	}
+	// no volume is given
+	else if( volume < 0 )
+	{
+		volume = m_sound_volume;
+	}
+
+	volume = static_cast<int>( volume * volume_mod );
+
+	const Uint32 ticks = SDL_GetTicks();
+
+	// coalesce with the same sound started shortly before
+	if( !loops )
+	{
+		for( AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr )
+		{
+			cAudio_Sound *obj = (*itr);
+
+			if( obj->m_channel < 0 || obj->m_data != sound_data || ticks - obj->m_start_time > m_sound_coalesce_time )
+			{
+				continue;
+			}
+
+			// use the louder volume
+			if( volume > obj->m_volume )
+			{
+				obj->m_volume = volume;
+				Mix_Volume( obj->m_channel, volume );
+			}
+
+			m_sound_coalesced_count++;
+			return 1;
+		}
+	}
+
+	const int priority = static_cast<int>( sound_data->m_priority * volume_mod );
+
 	// create channel
-	cAudio_Sound *sound = Create_Sound_Channel();
+	cAudio_Sound *sound = Create_Sound_Channel( priority );
 
 	if( !sound )
 	{
-		// no free channel available
+		// no channel with a lower priority available
+		m_sound_dropped_count++;
+
+		if( m_debug )
+		{
+			printf( "Dropped sound file : %s\n", filename.c_str() );
+		}
+
 		return 0;
 	}
 
@@ -497,17 +722,9 @@ bool cAudio :: Play_Sound( std::string filename, int res_id /* = -1 */, int volu
 	// playing successfully
 	else
 	{
-		// volume is out of range
-		if( volume > MIX_MAX_VOLUME )
-		{
-			printf( "PlaySound Volume is out of range : %d\n", volume );
-			volume = m_sound_volume;
-		}
-		// no volume is given
-		else if( volume < 0 )
-		{
-			volume = m_sound_volume;
-		}
+		sound->m_priority = priority;
+		sound->m_volume = volume;
+		sound->m_start_time = ticks;
 
 		// set volume
 		Mix_Volume( sound->m_channel, volume );
@@ -518,10 +735,7 @@ bool cAudio :: Play_Sound( std::string filename, int res_id /* = -1 */, int volu
 
 bool cAudio :: Play_Music( std::string filename, int loops /* = 0 */, bool force /* = 1 */, unsigned int fadein_ms /* = 0 */ )
 {
-	if( filename.find( DATA_DIR "/" GAME_MUSIC_DIR "/" ) == std::string::npos )
-	{
-		filename.insert( 0, DATA_DIR "/" GAME_MUSIC_DIR "/" );
-	}
+	filename = Get_Music_Path( filename );
 
 	// no valid file
 	if( !File_Exists( filename ) )
@@ -530,11 +744,25 @@ bool cAudio :: Play_Music( std::string filename, int loops /* = 0 */, bool force
 		return 0;
 	}
 
-	// save music filename
-	m_music_filename = filename;
-
 	if( !m_music_enabled || !m_initialised )
 	{
+		// save music filename to play it if music gets enabled
+		m_music_filename = filename;
+		return 0;
+	}
+
+	// load the given music
+	Mix_Music *music = Load_Music( filename );
+
+	// not loaded
+	if( !music )
+	{
+		if( m_debug )
+		{
+			printf( "Couldn't load music file : %s\n", filename.c_str() );
+		}
+
+		// failed to play
 		return 0;
 	}
 
@@ -548,42 +776,26 @@ bool cAudio :: Play_Music( std::string filename, int loops /* = 0 */, bool force
 		if( m_music )
 		{
 			Halt_Music();
-			Mix_FreeMusic( m_music );
+			Free_Music( m_music );
 		}
 		// free old music
 		if( m_music_old )
 		{
-			Mix_FreeMusic( m_music_old );
+			Free_Music( m_music_old );
 			m_music_old = NULL;
 		}
 
-		// load the given music
-		m_music = Mix_LoadMUS( filename.c_str() );
+		m_music = music;
 
-		// loaded
-		if( m_music )
+		// no fade in
+		if( !fadein_ms )
 		{
-			// no fade in
-			if( !fadein_ms )
-			{
-				Mix_PlayMusic( m_music, loops );
-			}
-			// fade in
-			else
-			{
-				Mix_FadeInMusic( m_music, loops, fadein_ms );
-			}
+			Mix_PlayMusic( m_music, loops );
 		}
-		// not loaded
-		else 
+		// fade in
+		else
 		{
-			if( m_debug )
-			{
-				printf( "Couldn't load music file : %s\n", filename.c_str() );
-			}
-
-			// failed to play
-			return 0;
+			Mix_FadeInMusic( m_music, loops, fadein_ms );
 		}
 	}
 	// music is playing and is not forced
@@ -595,7 +807,7 @@ bool cAudio :: Play_Music( std::string filename, int loops /* = 0 */, bool force
 			// if old music is loaded free the wanted next playing music data
 			if( m_music_old )
 			{
-				Mix_FreeMusic( m_music );
+				Free_Music( m_music );
 				m_music = NULL;
 			}
 			// if no old music move current to old music
@@ -606,13 +818,88 @@ bool cAudio :: Play_Music( std::string filename, int loops /* = 0 */, bool force
 			}
 		}
 
-		// load the wanted next playing music
-		m_music = Mix_LoadMUS( filename.c_str() );
+		// the wanted next playing music
+		m_music = music;
 	}
-	
+
+	// save music filename
+	m_music_filename = filename;
 	return 1;
 }
 
+void cAudio :: Prefetch_Music( std::string filename )
+{
+	if( !m_music_enabled || !m_initialised || filename.empty() )
+	{
+		return;
+	}
+
+	filename = Get_Music_Path( filename );
+
+	// already playing or read
+	if( filename.compare( m_music_filename ) == 0 || filename.compare( m_music_prefetch_filename ) == 0 )
+	{
+		return;
+	}
+
+	// only one music file is read ahead
+	Finish_Music_Prefetch();
+	m_music_prefetch_data.clear();
+
+	m_music_prefetch_filename = filename;
+	m_music_prefetch_thread = boost::thread( &cAudio::Read_Music_File, this, filename );
+}
+
+std::string cAudio :: Get_Music_Path( std::string filename )
+{
+	if( filename.find( DATA_DIR "/" GAME_MUSIC_DIR "/" ) == std::string::npos )
+	{
+		filename.insert( 0, DATA_DIR "/" GAME_MUSIC_DIR "/" );
+	}
+
+	return filename;
+}
+
+void cAudio :: Read_Music_File( const std::string &filename )
+{
+	// only reads the file data as the mixer is not thread safe
+#ifdef _WIN32
+	ifstream ifs( utf8_to_ucs2( filename ).c_str(), ios::in | ios::binary );
+#else
+	ifstream ifs( filename.c_str(), ios::in | ios::binary );
+#endif
+
+	// music in the package is loaded from the package data
+	if( !ifs.is_open() )
+	{
+		return;
+	}
+
+	ifs.seekg( 0, ios::end );
+	const std::streamoff size = ifs.tellg();
+	ifs.seekg( 0, ios::beg );
+
+	if( size <= 0 )
+	{
+		return;
+	}
+
+	m_music_prefetch_data.resize( static_cast<size_t>(size) );
+
+	if( !ifs.read( &m_music_prefetch_data[0], size ) )
+	{
+		m_music_prefetch_data.clear();
+	}
+}
+
+void cAudio :: Finish_Music_Prefetch( void )
+{
+	if( m_music_prefetch_thread.joinable() )
+	{
+		m_music_prefetch_thread.join();
+	}
+}
+
 cAudio_Sound *cAudio :: Get_Playing_Sound( std::string filename )
 {
 	if( !m_sound_enabled || !m_initialised )
@@ -650,7 +937,22 @@ cAudio_Sound *cAudio :: Get_Playing_Sound( std::string filename )
 	return NULL;
 }
 
-cAudio_Sound *cAudio :: Create_Sound_Channel( void )
+bool cAudio :: Is_Sound_Playing( const cSound *sound ) const
+{
+	for( AudioSoundList::const_iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr )
+	{
+		const cAudio_Sound *obj = (*itr);
+
+		if( obj->m_data == sound && obj->m_channel >= 0 )
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+cAudio_Sound *cAudio :: Create_Sound_Channel( int priority /* = SOUND_PRIORITY_DEFAULT */ )
 {
 	// get all sounds
 	for( AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr )
@@ -675,6 +977,32 @@ cAudio_Sound *cAudio :: Create_Sound_Channel( void )
 		return sound;
 	}
 
+	// find the least important voice
+	cAudio_Sound *lowest = NULL;
+
+	for( AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr )
+	{
+		cAudio_Sound *obj = (*itr);
+
+		if( !lowest || obj->m_priority < lowest->m_priority || ( obj->m_priority == lowest->m_priority && obj->m_start_time < lowest->m_start_time ) )
+		{
+			lowest = obj;
+		}
+	}
+
+	// steal it if not more important
+	if( lowest && lowest->m_priority <= priority )
+	{
+		if( m_debug )
+		{
+			printf( "Stopped sound file : %s for a more important sound\n", lowest->m_data->m_filename.c_str() );
+		}
+
+		lowest->Free();
+		m_sound_stolen_count++;
+		return lowest;
+	}
+
 	// none found
 	return NULL;
 }
@@ -992,14 +1320,99 @@ void cAudio :: Update( void )
 			// delete old music if available
 			if( m_music_old )
 			{
-				Mix_FreeMusic( m_music_old );
+				Free_Music( m_music_old );
 				m_music_old = NULL;
 			}
 		}
 	}
 }
 
-/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+Mix_Music *cAudio :: Load_Music( const std::string &filename )
+{
+	// read ahead with Prefetch_Music
+	if( filename.compare( m_music_prefetch_filename ) == 0 )
+	{
+		Finish_Music_Prefetch();
+		m_music_prefetch_filename.clear();
+
+		if( !m_music_prefetch_data.empty() )
+		{
+			// music is streamed from the read data while playing
+			SDL_RWops *rw = SDL_RWFromConstMem( &m_music_prefetch_data[0], static_cast<int>(m_music_prefetch_data.size()) );
+			Mix_Music *music = Mix_LoadMUS_RW( rw );
+
+			if( music )
+			{
+				m_music_sources[music] = rw;
+				// keep the data until the music is freed
+				vector<char> *data = new vector<char>();
+				data->swap( m_music_prefetch_data );
+				m_music_data[music] = data;
+				return music;
+			}
+
+			SDL_RWclose( rw );
+			m_music_prefetch_data.clear();
+		}
+	}
+
+	// loose files override the package
+	Mix_Music *music = Mix_LoadMUS( filename.c_str() );
+
+	if( music || !pResource_Manager )
+	{
+		return music;
+	}
+
+	size_t size = 0;
+	const char *data = pResource_Manager->Get_Package_File( filename, size );
+
+	if( !data )
+	{
+		return NULL;
+	}
+
+	// music is streamed from the source while playing
+	SDL_RWops *rw = SDL_RWFromConstMem( data, static_cast<int>(size) );
+	music = Mix_LoadMUS_RW( rw );
+
+	if( !music )
+	{
+		SDL_RWclose( rw );
+		return NULL;
+	}
+
+	m_music_sources[music] = rw;
+	return music;
+}
+
+void cAudio :: Free_Music( Mix_Music *music )
+{
+	if( !music )
+	{
+		return;
+	}
+
+	Mix_FreeMusic( music );
+
+	MusicSourceMap::iterator itr = m_music_sources.find( music );
+
+	if( itr != m_music_sources.end() )
+	{
+		SDL_RWclose( itr->second );
+		m_music_sources.erase( itr );
+	}
+
+	MusicDataMap::iterator data_itr = m_music_data.find( music );
+
+	if( data_itr != m_music_data.end() )
+	{
+		delete data_itr->second;
+		m_music_data.erase( data_itr );
+	}
+}
+
+/* ****** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 cAudio *pAudio = NULL;
 
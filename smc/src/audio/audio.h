@@ -18,6 +18,8 @@
 
 #include "../core/global_basic.h"
 #include "../audio/sound_manager.h"
+#include <boost/unordered_map.hpp>
+#include <boost/thread/thread.hpp>
 
 namespace SMC
 {
@@ -44,6 +46,11 @@ enum AudioChannel
 	RID_MOON			= 7
 };
 
+/* Return the volume modifier of a sound at the given distance to the camera
+ * full volume until reduction_begin and silent from reduction_end
+*/
+float Get_Distance_Volume_Factor( float distance, float reduction_begin, float reduction_end );
+
 /* *** *** *** *** *** *** *** Audio Sound object *** *** *** *** *** *** *** *** *** *** */
 	
 // Callback for a sound finished playing 
@@ -77,6 +84,12 @@ public:
 	int m_channel;
 	// the last used resource id
 	int m_resource_id;
+	// voice priority while playing
+	int m_priority;
+	// volume while playing
+	int m_volume;
+	// time when it started playing
+	Uint32 m_start_time;
 };
 
 typedef vector<cAudio_Sound *> AudioSoundList;
@@ -102,19 +115,42 @@ public:
 	 */
 	cSound *Get_Sound_File( std::string filename ) const;
 
-	// Play the given sound
+	/* Load and decode the sounds in a background thread
+	 * filenames : sounds as given to Get_Sound_File
+	*/
+	void Start_Sound_Decode( const vector<std::string> &filenames );
+	// Wait for the background loading and add the loaded sounds to the sound manager
+	void Finish_Sound_Decode( void );
+
+	/* Play the given sound
+	 * the same sound started again within the coalesce time is only played once
+	*/
 	bool Play_Sound( std::string filename, int res_id = -1, int volume = -1, int loops = 0 );
-	// If no forcing it will be played after the current music
+	/* Play the given sound from the level position
+	 * the volume and priority are reduced by the distance to the camera center
+	*/
+	bool Play_Sound_At( std::string filename, float pos_x, float pos_y, int res_id = -1, int volume = -1 );
+	/* Play the given music
+	 * if no forcing it will be played after the current music
+	 * returns 0 if the music could not be loaded
+	*/
 	bool Play_Music( std::string filename, int loops = 0, bool force = 1, unsigned int fadein_ms = 0 ); 
+	/* Read the music file in a background thread
+	 * if it is played afterwards it is loaded from the read data
+	*/
+	void Prefetch_Music( std::string filename );
 
 	/* Returns a pointer to the sound if it is active.
 	 * The returned sound should not be deleted or modified.
 	 */
 	cAudio_Sound *Get_Playing_Sound( std::string filename );
+	// Returns true if the sound data is used by a playing channel
+	bool Is_Sound_Playing( const cSound *sound ) const;
 
-	/* Returns true if a free channel for the sound is available
+	/* Returns a free channel for the sound or NULL if not available
+	 * if all channels are used the lowest and oldest voice with the same or a lower priority is stopped
 	*/
-	cAudio_Sound *Create_Sound_Channel( void );
+	cAudio_Sound *Create_Sound_Channel( int priority = SOUND_PRIORITY_DEFAULT );
 
 	// Toggle Music on/off
 	void Toggle_Music( void );
@@ -186,6 +222,11 @@ public:
 	// Update
 	void Update( void );
 
+	// Load the music from the prefetched data, the file or the package
+	Mix_Music *Load_Music( const std::string &filename );
+	// Free the music and its package source or prefetched data
+	void Free_Music( Mix_Music *music );
+
 	// is the audio engine initialized
 	bool m_initialised;
 	// is sound enabled
@@ -204,15 +245,57 @@ public:
 	Mix_Music *m_music;
 	// if new music should play after the current this is the old data
 	Mix_Music *m_music_old;
+	// package sources which must stay open while the music is loaded
+	typedef boost::unordered_map<Mix_Music *, SDL_RWops *> MusicSourceMap;
+	MusicSourceMap m_music_sources;
+	// prefetched data which must stay available while the music is loaded
+	typedef boost::unordered_map<Mix_Music *, vector<char> *> MusicDataMap;
+	MusicDataMap m_music_data;
 
 	// The current sounds pointer array
 	AudioSoundList m_active_sounds;
 
 	// maximum sounds allowed at once
 	unsigned int m_max_sounds;
+	// time in milliseconds in which the same sound is only played once
+	Uint32 m_sound_coalesce_time;
+	// distance to the camera center where the sound volume reduction begins and ends
+	float m_sound_reduction_begin;
+	float m_sound_reduction_end;
+	// sounds coalesced, stopped for a more important sound and dropped since initialization
+	unsigned int m_sound_coalesced_count;
+	unsigned int m_sound_stolen_count;
+	unsigned int m_sound_dropped_count;
 
 	// initialization information
 	int m_audio_buffer, m_audio_channels;
+
+private:
+	// Load and decode the sounds in the background thread
+	void Decode_Sounds( const vector<std::string> &filenames );
+	/* Play the sound with the volume and priority multiplied by volume_mod
+	 * used by Play_Sound and Play_Sound_At
+	*/
+	bool Play_Sound_Voice( std::string filename, int res_id, int volume, int loops, float volume_mod );
+
+	// Return the music filename with the music directory
+	static std::string Get_Music_Path( std::string filename );
+	// Read the music file data in the background thread
+	void Read_Music_File( const std::string &filename );
+	// Wait for the background music file reading
+	void Finish_Music_Prefetch( void );
+
+	// background music file reading thread
+	boost::thread m_music_prefetch_thread;
+	// music file read in the background
+	std::string m_music_prefetch_filename;
+	// read music file data which is empty if not available
+	vector<char> m_music_prefetch_data;
+
+	// sounds loaded in the background thread
+	SoundList m_decoded_sounds;
+	// background sound loading thread
+	boost::thread m_decode_thread;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -292,15 +292,7 @@ float cRandom_Sound :: Get_Volume_Reduction_End( void ) const
 
 float cRandom_Sound :: Get_Distance_Volume_Mod( void ) const
 {
-	// if in volume reduction range
-	if( m_distance_to_camera > m_volume_reduction_begin )
-	{
-		const float distance = m_distance_to_camera - m_volume_reduction_begin;
-		return 1.0f - distance / ( m_volume_reduction_end - m_volume_reduction_begin );
-	}
-
-	// no reduction
-	return 1.0f;
+	return Get_Distance_Volume_Factor( m_distance_to_camera, m_volume_reduction_begin, m_volume_reduction_end );
 }
 
 void cRandom_Sound :: Update( void )
@@ -358,7 +350,7 @@ void cRandom_Sound :: Update( void )
 
 			if( m_delay_max > m_delay_min )
 			{
-				m_next_play_delay += Get_Random_Float( 0.0f, static_cast<float>(m_delay_max - m_delay_min) );
+				m_next_play_delay += Get_Random_Float( 0.0f, static_cast<float>(m_delay_max - m_delay_min), RANDOM_STREAM_AUDIO );
 			}
 		}
 	}
@@ -378,7 +370,7 @@ void cRandom_Sound :: Update( void )
 			// random
 			if( m_volume_max > m_volume_min )
 			{
-				sound_volume = Get_Random_Float( m_volume_min, m_volume_max );
+				sound_volume = Get_Random_Float( m_volume_min, m_volume_max, RANDOM_STREAM_AUDIO );
 			}
 			// static
 			else
@@ -14,6 +14,11 @@
 */
 
 #include "../audio/sound_manager.h"
+#include "../audio/audio.h"
+#include "../core/filesystem/filesystem.h"
+#include "../core/filesystem/resource_manager.h"
+// boost timing
+#include <boost/date_time/posix_time/posix_time_types.hpp>
 
 namespace SMC
 {
@@ -23,6 +28,8 @@ namespace SMC
 cSound :: cSound( void )
 {
 	m_chunk = NULL;
+	m_decode_failed = 0;
+	m_priority = SOUND_PRIORITY_DEFAULT;
 }
 
 cSound :: ~cSound( void )
@@ -33,29 +40,170 @@ cSound :: ~cSound( void )
 bool cSound :: Load( const std::string &filename )
 {
 	Free();
+
+	SDL_RWops *rw = pResource_Manager->Open_File( filename );
+
+	if( !rw )
+	{
+		return 0;
+	}
+
+	// keep the file data compressed
+	const int size = SDL_RWseek( rw, 0, SEEK_END );
+
+	if( size > 0 && SDL_RWseek( rw, 0, SEEK_SET ) == 0 )
+	{
+		m_data.resize( size );
+
+		if( SDL_RWread( rw, &m_data[0], 1, size ) != size )
+		{
+			m_data.clear();
+		}
+	}
+
+	SDL_RWclose( rw );
+
+	if( m_data.empty() )
+	{
+		SDL_SetError( "Could not read sound data" );
+		return 0;
+	}
+
+	m_filename = filename;
+	return 1;
+}
+
+void cSound :: Free( void )
+{
+	Free_Chunk();
 	
-	m_chunk = Mix_LoadWAV( filename.c_str() );
+	// release the memory
+	vector<Uint8>().swap( m_data );
+	m_decode_failed = 0;
+	m_filename.clear();
+}
 
+bool cSound :: Decode( void )
+{
 	if( m_chunk )
 	{
-		m_filename = filename;
 		return 1;
 	}
-	
-	return 0;
+
+	if( m_data.empty() || m_decode_failed )
+	{
+		return 0;
+	}
+
+	m_chunk = Mix_LoadWAV_RW( SDL_RWFromConstMem( &m_data[0], m_data.size() ), 1 );
+
+	// failed decoding
+	if( !m_chunk )
+	{
+		printf( "Could not decode sound file : %s \nReason : %s\n", m_filename.c_str(), Mix_GetError() );
+		// don't try again
+		m_decode_failed = 1;
+		return 0;
+	}
+
+	return 1;
 }
 
-void cSound :: Free( void )
+Mix_Chunk *cSound :: Get_Chunk( void )
 {
 	if( m_chunk )
 	{
-		Mix_FreeChunk( m_chunk );
-		m_chunk = NULL;
+		if( pSound_Manager )
+		{
+			pSound_Manager->Touch_Decoded( this );
+		}
+
+		return m_chunk;
+	}
+
+	const boost::posix_time::ptime decode_start = boost::posix_time::microsec_clock::universal_time();
+
+	if( !Decode() )
+	{
+		return NULL;
 	}
+
+	const float decode_time = static_cast<float>( ( boost::posix_time::microsec_clock::universal_time() - decode_start ).total_microseconds() ) / 1000.0f;
+
+	if( pSound_Manager )
+	{
+		pSound_Manager->Add_Decoded( this );
+		pSound_Manager->Add_Decode_Time( decode_time );
+	}
+
+	if( pAudio && pAudio->m_debug )
+	{
+		printf( "Decoded sound file : %s (%d KB) in %.2f ms\n", m_filename.c_str(), m_chunk->alen / 1024, decode_time );
+	}
+
+	return m_chunk;
+}
+
+void cSound :: Free_Chunk( void )
+{
+	if( !m_chunk )
+	{
+		return;
+	}
+
+	if( pSound_Manager )
+	{
+		pSound_Manager->Remove_Decoded( this );
+	}
+
+	Mix_FreeChunk( m_chunk );
+	m_chunk = NULL;
+}
+
+
+/* *** *** *** *** *** *** cSound_Priority_Parser *** *** *** *** *** *** *** *** *** *** *** */
+
+cSound_Priority_Parser :: cSound_Priority_Parser( void )
+: cFile_parser()
+{
 	
-	m_filename.clear();
 }
 
+cSound_Priority_Parser :: ~cSound_Priority_Parser( void )
+{
+	
+}
+
+bool cSound_Priority_Parser :: HandleMessage( const cFile_Token *parts, unsigned int count, unsigned int line )
+{
+	if( count != 2 )
+	{
+		printf( "%s : line %d Error :\n", Trim_Filename( data_file, 0, 0 ).c_str(), line );
+		printf( "Error : %s %s\n", parts[0].c_str(), "needs 2 parameters" );
+		return 0;
+	}
+
+	if( !parts[1].Is_Number( 0 ) )
+	{
+		printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
+		printf( "%s is not a valid integer value\n", parts[1].c_str() );
+		return 0;
+	}
+
+	int priority = parts[1].To_Int();
+
+	if( priority < SOUND_PRIORITY_MIN )
+	{
+		priority = SOUND_PRIORITY_MIN;
+	}
+	else if( priority > SOUND_PRIORITY_MAX )
+	{
+		priority = SOUND_PRIORITY_MAX;
+	}
+
+	m_priorities[data_file.substr( 0, data_file.rfind( "/" ) + 1 ) + parts[0].c_str()] = priority;
+	return 1;
+}
 
 /* *** *** *** *** *** *** cSound_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -63,6 +211,14 @@ cSound_Manager :: cSound_Manager( void )
 : cObject_Manager<cSound>()
 {
 	m_load_count = 0;
+	m_priority_default = SOUND_PRIORITY_DEFAULT;
+
+	m_compressed_size = 0;
+	m_decoded_size = 0;
+	m_decoded_size_max = 8 * 1024 * 1024;
+	m_decode_count = 0;
+	m_decode_time_last = 0.0f;
+	m_decode_time_max = 0.0f;
 }
 
 cSound_Manager :: ~cSound_Manager( void )
@@ -90,9 +246,42 @@ cSound *cSound_Manager :: Get_Pointer( const std::string &path ) const
 void cSound_Manager :: Add( cSound *sound )
 {
 	m_load_count++;
+	m_compressed_size += sound->m_data.size();
+	sound->m_priority = Get_Priority( sound->m_filename );
 	cObject_Manager<cSound>::Add( sound );
 }
 
+bool cSound_Manager :: Delete( size_t array_num, bool delete_data /* = 1 */ )
+{
+	cSound *obj = cObject_Manager<cSound>::Get_Pointer( array_num );
+
+	// not in vector
+	if( !obj )
+	{
+		return 0;
+	}
+
+	m_compressed_size -= obj->m_data.size();
+	return cObject_Manager<cSound>::Delete( array_num, delete_data );
+}
+
+bool cSound_Manager :: Delete( cSound *obj, bool delete_data /* = 1 */ )
+{
+	// only count sounds in the manager
+	if( obj && std::find( objects.begin(), objects.end(), obj ) != objects.end() )
+	{
+		m_compressed_size -= obj->m_data.size();
+	}
+
+	return cObject_Manager<cSound>::Delete( obj, delete_data );
+}
+
+void cSound_Manager :: Delete_All( void )
+{
+	cObject_Manager<cSound>::Delete_All();
+	m_compressed_size = 0;
+}
+
 void cSound_Manager :: Delete_Sounds( void )
 {
 	for( SoundList::iterator itr = objects.begin(); itr != objects.end(); ++itr )
@@ -102,6 +291,112 @@ void cSound_Manager :: Delete_Sounds( void )
 		delete obj;
 		obj = NULL;
 	}
+
+	m_compressed_size = 0;
+}
+
+bool cSound_Manager :: Load_Priorities( const std::string &filename )
+{
+	cSound_Priority_Parser parser;
+
+	if( !parser.Parse( filename ) )
+	{
+		return 0;
+	}
+
+	m_priorities.swap( parser.m_priorities );
+
+	// update the loaded sounds
+	for( SoundList::iterator itr = objects.begin(); itr != objects.end(); ++itr )
+	{
+		cSound *obj = (*itr);
+
+		obj->m_priority = Get_Priority( obj->m_filename );
+	}
+
+	return 1;
+}
+
+int cSound_Manager :: Get_Priority( const std::string &filename ) const
+{
+	SoundPriorityMap::const_iterator itr = m_priorities.find( filename );
+
+	if( itr == m_priorities.end() )
+	{
+		return m_priority_default;
+	}
+
+	return itr->second;
+}
+
+void cSound_Manager :: Add_Decoded( cSound *sound )
+{
+	m_decoded.push_back( sound );
+	m_decoded_size += sound->m_chunk->alen;
+	m_decode_count++;
+
+	// free the least recently used sounds
+	for( unsigned int i = 0; m_decoded_size > m_decoded_size_max && i < m_decoded.size(); )
+	{
+		cSound *obj = m_decoded[i];
+
+		// keep the new and the playing sounds
+		if( obj == sound || ( pAudio && pAudio->Is_Sound_Playing( obj ) ) )
+		{
+			i++;
+			continue;
+		}
+
+		// removes it from the decoded sounds
+		obj->Free_Chunk();
+	}
+}
+
+void cSound_Manager :: Add_Decode_Time( float decode_time )
+{
+	m_decode_time_last = decode_time;
+
+	if( decode_time > m_decode_time_max )
+	{
+		m_decode_time_max = decode_time;
+	}
+}
+
+void cSound_Manager :: Touch_Decoded( cSound *sound )
+{
+	// already the most recently used
+	if( !m_decoded.empty() && m_decoded.back() == sound )
+	{
+		return;
+	}
+
+	SoundList::iterator itr = std::find( m_decoded.begin(), m_decoded.end(), sound );
+
+	if( itr == m_decoded.end() )
+	{
+		return;
+	}
+
+	m_decoded.erase( itr );
+	m_decoded.push_back( sound );
+}
+
+void cSound_Manager :: Remove_Decoded( cSound *sound )
+{
+	SoundList::iterator itr = std::find( m_decoded.begin(), m_decoded.end(), sound );
+
+	if( itr == m_decoded.end() )
+	{
+		return;
+	}
+
+	m_decoded_size -= sound->m_chunk->alen;
+	m_decoded.erase( itr );
+}
+
+void cSound_Manager :: Set_Decoded_Size_Max( unsigned int size )
+{
+	m_decoded_size_max = size;
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
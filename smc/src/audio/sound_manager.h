@@ -18,6 +18,8 @@
 
 #include "../core/global_basic.h"
 #include "../core/obj_manager.h"
+#include "../core/file_parser.h"
+#include <boost/unordered_map.hpp>
 // SDL
 // also includes needed SDL headers
 #include "SDL_mixer.h"
@@ -25,6 +27,15 @@
 namespace SMC
 {
 
+// voice priority of a sound
+enum SoundPriority
+{
+	SOUND_PRIORITY_MIN = 0,
+	// used for sounds without a priority
+	SOUND_PRIORITY_DEFAULT = 50,
+	SOUND_PRIORITY_MAX = 100
+};
+
 /* *** *** *** *** *** *** *** Sound object *** *** *** *** *** *** *** *** *** *** */
 
 class cSound
@@ -33,18 +44,57 @@ public:
 	cSound( void );
 	virtual ~cSound( void );
 	
-	// Load the data
+	/* Load the compressed data
+	 * the sound is decoded on the first play
+	*/
 	bool Load( const std::string &filename );
 	// Free the data
 	void Free( void );
 
+	/* Decode the compressed data if not already decoded
+	 * does not use the sound manager and is also called from the background loading thread
+	 * returns 0 if decoding failed
+	*/
+	bool Decode( void );
+	/* Return the decoded data or NULL if decoding failed
+	 * decodes the compressed data if needed and marks it as recently used in the sound manager
+	*/
+	Mix_Chunk *Get_Chunk( void );
+	// Free only the decoded data
+	void Free_Chunk( void );
+
 	// filename
 	std::string m_filename;
-	// data if loaded else null
+	// compressed file data
+	vector<Uint8> m_data;
+	// decoded data if used else null
 	Mix_Chunk *m_chunk;
+	// if decoding failed and is not tried again
+	bool m_decode_failed;
+	// voice priority from 0 to 100
+	int m_priority;
 };
 
 typedef vector<cSound *> SoundList;
+typedef boost::unordered_map<std::string, int> SoundPriorityMap;
+
+/* *** *** *** *** *** *** cSound_Priority_Parser *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Parses the sound priority file
+ * each line is a sound file relative to the priority file and its priority from 0 to 100
+*/
+class cSound_Priority_Parser : public cFile_parser
+{
+public:
+	cSound_Priority_Parser( void );
+	virtual ~cSound_Priority_Parser( void );
+
+	// Handle one tokenized line
+	virtual bool HandleMessage( const cFile_Token *parts, unsigned int count, unsigned int line );
+
+	// parsed priorities by sound filename
+	SoundPriorityMap m_priorities;
+};
 
 /* *** *** *** *** *** *** cSound_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -78,12 +128,79 @@ public:
 		return Get_Pointer( path );
 	}
 
+	// Delete the Sound from the given array number
+	virtual bool Delete( size_t array_num, bool delete_data = 1 );
+	// Delete the given Sound
+	virtual bool Delete( cSound *obj, bool delete_data = 1 );
+	// Delete all Sounds
+	virtual void Delete_All( void );
 	// Delete all Sounds, but keep object vector entries
 	void Delete_Sounds( void );
 
+	// Load the sound priorities from the file
+	bool Load_Priorities( const std::string &filename );
+	// Return the priority of the sound file
+	int Get_Priority( const std::string &filename ) const;
+
+	/* Add the newly decoded sound to the decoded sounds
+	 * frees the least recently used decoded sounds which are not playing if over the size limit
+	*/
+	void Add_Decoded( cSound *sound );
+	// Add the time in milliseconds needed to decode a sound on the first play
+	void Add_Decode_Time( float decode_time );
+	// Mark the decoded sound as recently used
+	void Touch_Decoded( cSound *sound );
+	// Remove the sound from the decoded sounds
+	void Remove_Decoded( cSound *sound );
+	// Set the size limit of the decoded sounds in bytes
+	void Set_Decoded_Size_Max( unsigned int size );
+
+	// Return the size of the compressed sound data in bytes
+	inline unsigned int Get_Compressed_Size( void ) const
+	{
+		return m_compressed_size;
+	};
+	// Return the size of the decoded sound data in bytes
+	inline unsigned int Get_Decoded_Size( void ) const
+	{
+		return m_decoded_size;
+	};
+	// Return the number of sounds decoded since initialization
+	inline unsigned int Get_Decode_Count( void ) const
+	{
+		return m_decode_count;
+	};
+	// Return the last and the longest decode time on the first play in milliseconds
+	inline float Get_Decode_Time_Last( void ) const
+	{
+		return m_decode_time_last;
+	};
+	inline float Get_Decode_Time_Max( void ) const
+	{
+		return m_decode_time_max;
+	};
+
 private:
 	// sounds loaded since initialization
 	unsigned int m_load_count;
+
+	// sound priorities by filename
+	SoundPriorityMap m_priorities;
+	// priority of sounds without a priority
+	int m_priority_default;
+
+	// decoded sounds with the least recently used first
+	SoundList m_decoded;
+	// size of the compressed and decoded sound data
+	unsigned int m_compressed_size;
+	unsigned int m_decoded_size;
+	// size limit of the decoded sound data
+	unsigned int m_decoded_size_max;
+	// sounds decoded since initialization
+	unsigned int m_decode_count;
+	// last and longest decode time in milliseconds
+	float m_decode_time_last;
+	float m_decode_time_max;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
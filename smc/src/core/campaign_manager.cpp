@@ -56,6 +56,8 @@ bool cCampaign :: Save( const std::string &filename )
 		return 0;
 	}
 
+	pResource_Manager->Set_Indexed_File( filename, 1 );
+
 	CEGUI::XMLSerializer stream( file );
 
 	// begin
@@ -26,17 +26,50 @@
 namespace SMC
 {
 
+/* *** *** *** *** *** *** *** Memory pools *** *** *** *** *** *** *** *** *** *** */
+
+/* collisions are created and deleted many times every frame
+ * the pools keep that memory after the first frames
+*/
+static cMemory_Pool collision_memory_pool( sizeof(cObjectCollision), 512 );
+static cMemory_Pool collision_list_memory_pool( sizeof(cObjectCollisionType), 64 );
+
+// collision list buffers kept for reuse
+static vector<cObjectCollision_List> collision_list_buffers;
+
 /* *** *** *** *** *** *** *** cObjectCollisionType *** *** *** *** *** *** *** *** *** *** */
 
 cObjectCollisionType :: cObjectCollisionType( void )
 : cObject_Manager<cObjectCollision>()
 {
-
+	// reuse the memory of a deleted list
+	if( !collision_list_buffers.empty() )
+	{
+		objects.swap( collision_list_buffers.back() );
+		collision_list_buffers.pop_back();
+	}
 }
 
 cObjectCollisionType :: ~cObjectCollisionType( void )
 {
 	Delete_All();
+
+	// keep the memory for the next list
+	if( objects.capacity() && collision_list_buffers.size() < 64 )
+	{
+		collision_list_buffers.push_back( cObjectCollision_List() );
+		collision_list_buffers.back().swap( objects );
+	}
+}
+
+void *cObjectCollisionType :: operator new( size_t size )
+{
+	return collision_list_memory_pool.Allocate( size );
+}
+
+void cObjectCollisionType :: operator delete( void *ptr, size_t size )
+{
+	collision_list_memory_pool.Release( ptr, size );
 }
 
 void cObjectCollisionType :: Add( cObjectCollision *obj )
@@ -128,6 +161,16 @@ cObjectCollision :: ~cObjectCollision( void )
 	//
 }
 
+void *cObjectCollision :: operator new( size_t size )
+{
+	return collision_memory_pool.Allocate( size );
+}
+
+void cObjectCollision :: operator delete( void *ptr, size_t size )
+{
+	collision_memory_pool.Release( ptr, size );
+}
+
 void cObjectCollision :: Set_Direction( const cSprite *base, const cSprite *col )
 {
 	m_direction = Get_Collision_Direction( base, col );
@@ -135,6 +178,16 @@ void cObjectCollision :: Set_Direction( const cSprite *base, const cSprite *col
 
 /* *** *** *** *** *** *** *** functions *** *** *** *** *** *** *** *** *** *** */
 
+cMemory_Pool *Get_Collision_Memory_Pool( void )
+{
+	return &collision_memory_pool;
+}
+
+cMemory_Pool *Get_Collision_List_Memory_Pool( void )
+{
+	return &collision_list_memory_pool;
+}
+
 ObjectDirection Get_Collision_Direction( const cSprite *base, const cSprite *col )
 {
 	// if valid moving sprite try the velocity based detection
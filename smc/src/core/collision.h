@@ -21,6 +21,7 @@
 #include "../core/global_basic.h"
 #include "../core/global_game.h"
 #include "../core/obj_manager.h"
+#include "../core/memory_pool.h"
 #include "../core/math/rect.h"
 #include "SDL.h"
 
@@ -36,6 +37,10 @@ public:
 	cObjectCollision( void );
 	~cObjectCollision( void );
 
+	// allocated from the collision memory pool
+	static void *operator new( size_t size );
+	static void operator delete( void *ptr, size_t size );
+
 	/* Set the collision direction
 	 * base - the base sprite
 	 * col - the colliding sprite
@@ -72,6 +77,10 @@ public:
 	cObjectCollisionType( void );
 	virtual ~cObjectCollisionType( void );
 
+	// allocated from the collision list memory pool
+	static void *operator new( size_t size );
+	static void operator delete( void *ptr, size_t size );
+
 	// Add an object collision
 	virtual void Add( cObjectCollision *obj );
 
@@ -92,6 +101,11 @@ public:
 
 /* *** *** *** *** *** *** *** functions *** *** *** *** *** *** *** *** *** *** */
 
+// Return the memory pool used for collision objects
+cMemory_Pool *Get_Collision_Memory_Pool( void );
+// Return the memory pool used for collision lists
+cMemory_Pool *Get_Collision_List_Memory_Pool( void );
+
 /* Returns the collision direction
  * base - the base sprite
  * col - the colliding sprite
@@ -16,13 +16,60 @@
 #include "../core/global_basic.h"
 #include "../core/file_parser.h"
 #include "../core/game_core.h"
+#include "../core/filesystem/resource_manager.h"
 #include <cstdio>
+#include <cstdlib>
+#include <algorithm>
 
 namespace SMC
 {
 
+/* *** *** *** *** *** *** *** *** cFile_Token *** *** *** *** *** *** *** *** *** */
+
+bool cFile_Token :: Is_Number( bool accept_floating_point /* = 1 */ ) const
+{
+	const char *pos = m_data;
+	bool point_found = 0;
+
+	// accept negative numbers
+	if( *pos == '-' )
+	{
+		pos++;
+	}
+
+	for( ; *pos != '\0'; pos++ )
+	{
+		if( *pos >= '0' && *pos <= '9' )
+		{
+			continue;
+		}
+
+		// accept one point if given
+		if( *pos == '.' && accept_floating_point && !point_found )
+		{
+			point_found = 1;
+			continue;
+		}
+
+		return 0;
+	}
+
+	return 1;
+}
+
+int cFile_Token :: To_Int( void ) const
+{
+	return static_cast<int>(strtol( m_data, NULL, 10 ));
+}
+
 /* *** *** *** *** *** *** *** *** cFile_parser *** *** *** *** *** *** *** *** *** */
 
+// Return true if the character separates tokens
+static inline bool Is_Token_Separator( char c )
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
 cFile_parser :: cFile_parser( void )
 {
 	//
@@ -35,92 +82,111 @@ cFile_parser :: ~cFile_parser( void )
 
 bool cFile_parser :: Parse( const std::string &filename )
 {
-	ifstream ifs( filename.c_str(), ios::in );
-	
-	if( !ifs )
+	ifstream ifs( filename.c_str(), ios::in | ios::binary );
+
+	if( ifs )
 	{
-		printf( "Could not load data file : %s\n", filename.c_str() );
-		return 0;
+		ifs.seekg( 0, ios::end );
+		const std::streamoff size = ifs.tellg();
+		ifs.seekg( 0, ios::beg );
+
+		// with a writable end for the last token
+		m_buffer.resize( static_cast<size_t>(size) + 1 );
+
+		if( size > 0 && !ifs.read( &m_buffer[0], size ) )
+		{
+			printf( "Could not load data file : %s\n", filename.c_str() );
+			return 0;
+		}
+	}
+	else
+	{
+		size_t size = 0;
+		const char *data = pResource_Manager ? pResource_Manager->Get_Package_File( filename, size ) : NULL;
+
+		if( !data )
+		{
+			printf( "Could not load data file : %s\n", filename.c_str() );
+			return 0;
+		}
+
+		// packaged data is read-only
+		m_buffer.resize( size + 1 );
+		std::copy( data, data + size, m_buffer.begin() );
 	}
 
+	m_buffer.back() = '\0';
 	data_file = filename;
 
-	std::string line;
+	char *pos = &m_buffer[0];
+	char *end = pos + m_buffer.size() - 1;
 	unsigned int line_num = 0;
 
-	while( std::getline( ifs, line ) )
+	while( pos < end )
 	{
+		char *line_end = static_cast<char *>(memchr( pos, '\n', end - pos ));
+
+		if( !line_end )
+		{
+			line_end = end;
+		}
+
 		line_num++;
-		Parse_Line( line, line_num );
+		Parse_Line( pos, line_end - pos, line_num );
+		pos = line_end + 1;
 	}
 
 	return 1;
 }
 
-bool cFile_parser :: Parse_Line( std::string str_line, int line_num )
+bool cFile_parser :: Parse_Line( char *line, size_t length, unsigned int line_num )
 {
-	if( str_line.empty() )
-	{
-		return 1;
-	}
+	char *pos = line;
+	char *end = line + length;
 
-	// linux support
-	string_erase_all( str_line, '\r' );
-	// no tabs
-	string_replace_all( str_line, "\t", " " );
 	// remove beginning spaces
-	string_trim_from_begin( str_line, ' ' );
-	// remove trailing spaces
-	string_trim_from_end( str_line, ' ' );
+	while( pos < end && Is_Token_Separator( *pos ) )
+	{
+		pos++;
+	}
 
 	// ignore empty lines and comments
-	if( str_line.empty() || *str_line.begin() == '#' )
+	if( pos == end || *pos == '#' )
 	{
 		// no error
 		return 1;
 	}
 
-	std::string tempstr = str_line;
-	int count = 1;
+	m_tokens.clear();
 
-	// count spaces
-	while( tempstr.find( ' ' ) != std::string::npos  )
+	while( pos < end )
 	{
-		tempstr.erase( tempstr.find( ' ' ) , 1 );
-		count++;
+		char *token = pos;
+
+		while( pos < end && !Is_Token_Separator( *pos ) )
+		{
+			pos++;
+		}
+
+		m_tokens.push_back( cFile_Token( token, static_cast<unsigned int>(pos - token) ) );
+		// terminate the token
+		*pos = '\0';
+		pos++;
+
+		while( pos < end && Is_Token_Separator( *pos ) )
+		{
+			pos++;
+		}
 	}
 
-	tempstr = str_line;
-	
-	std::string *parts = new std::string[ count + 1 ];
-	
-	std::string::size_type len;
-	int part_count = 0;
-
-	while( count > 0 )
-	{
-		// get length of the part
-		len = tempstr.find_first_of( ' ' );
-		// create part
-		parts[part_count] = tempstr.substr( 0, len );
-		// remove part from temp string
-		tempstr.erase( 0, len + 1 );
-
-		part_count++;
-		count--;
-	}
-
-	parts[part_count] = tempstr;
+	const unsigned int count = static_cast<unsigned int>(m_tokens.size());
+	m_tokens.push_back( cFile_Token() );
 
 	// Message handler
-	bool success = HandleMessage( parts, part_count, line_num );
-
-	delete []parts;
-
-	return success;
+	return HandleMessage( &m_tokens[0], count, line_num );
 }
 
-bool cFile_parser :: HandleMessage( const std::string *parts, unsigned int count, unsigned int line )
+bool cFile_parser :: HandleMessage( const cFile_Token *parts, unsigned int count, unsigned int line )
 {
 	// virtual
 	return 1;
@@ -17,13 +17,61 @@
 #define SMC_FILE_PARSER_H
 
 #include "../core/global_game.h"
+#include <cstring>
 
 namespace SMC
 {
 
+/* *** *** *** *** *** *** *** *** cFile_Token *** *** *** *** *** *** *** *** *** */
+
+/* Part of a tokenized line
+ * Points into the buffer of the parser and is only valid while the line is handled.
+*/
+class cFile_Token
+{
+public:
+	cFile_Token( void )
+	: m_data( "" ), m_length( 0 ) {};
+	cFile_Token( const char *data, unsigned int length )
+	: m_data( data ), m_length( length ) {};
+
+	// Compare with the string
+	inline bool operator==( const char *str ) const
+	{
+		return strcmp( m_data, str ) == 0;
+	}
+	inline bool operator!=( const char *str ) const
+	{
+		return strcmp( m_data, str ) != 0;
+	}
+
+	// Return true if the token is a number like Is_Valid_Number
+	bool Is_Number( bool accept_floating_point = 1 ) const;
+	// Return the integer value or 0 if not a number
+	int To_Int( void ) const;
+
+	// Return the zero terminated token
+	inline const char *c_str( void ) const
+	{
+		return m_data;
+	}
+	// Return a copy of the token
+	inline std::string str( void ) const
+	{
+		return std::string( m_data, m_length );
+	}
+
+	// zero terminated token data
+	const char *m_data;
+	// token length
+	unsigned int m_length;
+};
+
 /* *** *** *** *** *** *** *** *** cFile_parser *** *** *** *** *** *** *** *** *** */
 
-// Base class for parsing text files
+/* Base class for parsing text files
+ * The file is read at once and each line is tokenized in place without allocating memory.
+*/
 class cFile_parser
 {
 public:
@@ -33,14 +81,24 @@ public:
 	// Parses the given file
 	bool Parse( const std::string &filename );
 
-	// Tokenize a line
-	bool Parse_Line( std::string str_line, int line_num );
+	/* Tokenize the line in place
+	 * the character after the line is overwritten and must be writable
+	*/
+	bool Parse_Line( char *line, size_t length, unsigned int line_num );
 
-	// Handle one tokenized line
-	virtual bool HandleMessage( const std::string *parts, unsigned int count, unsigned int line );
+	/* Handle one tokenized line
+	 * parts[count] is an empty token
+	*/
+	virtual bool HandleMessage( const cFile_Token *parts, unsigned int count, unsigned int line );
 
 	// data filename
 	std::string data_file;
+
+private:
+	// file data
+	vector<char> m_buffer;
+	// tokens of the current line
+	vector<cFile_Token> m_tokens;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
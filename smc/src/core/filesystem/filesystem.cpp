@@ -14,6 +14,7 @@
 */
 
 #include "../../core/filesystem/filesystem.h"
+#include "../../core/filesystem/resource_manager.h"
 #include "../../core/game_core.h"
 // boost filesystem
 #include "boost/filesystem/convenience.hpp"
@@ -48,66 +49,134 @@ std::string Trim_Filename( std::string filename, bool keep_dir /* = 1 */, bool k
 
 bool File_Exists( const std::string &filename )
 {
-// fixme : boost should use a codecvt_facet but for now we convert to UCS-2
-#ifdef _WIN32
-	fs::file_type type = fs::status( fs::path( utf8_to_ucs2( filename ) ) ).type();
-#else
-	fs::file_type type = fs::status( fs::path( filename ) ).type();
-#endif
+	bool exists;
+
+	// known by the file index
+	if( pResource_Manager && pResource_Manager->Find_Indexed( filename, 0, exists ) )
+	{
+		if( exists )
+		{
+			return 1;
+		}
+	}
+	else
+	{
+	// fixme : boost should use a codecvt_facet but for now we convert to UCS-2
+	#ifdef _WIN32
+		fs::file_type type = fs::status( fs::path( utf8_to_ucs2( filename ) ) ).type();
+	#else
+		fs::file_type type = fs::status( fs::path( filename ) ).type();
+	#endif
+
+		if( type == fs::regular_file || type == fs::symlink_file )
+		{
+			return 1;
+		}
+	}
 
-	return type == fs::regular_file || type == fs::symlink_file;
+	// packaged
+	size_t size;
+	return pResource_Manager && pResource_Manager->Get_Package_File( filename, size ) != NULL;
 }
 
 bool Dir_Exists( const std::string &dir )
 {
-// fixme : boost should use a codecvt_facet but for now we convert to UCS-2
-#ifdef _WIN32
-	fs::file_type type = fs::status( fs::path( utf8_to_ucs2( dir ) ) ).type();
-#else
-	fs::file_type type = fs::status( fs::path( dir ) ).type();
-#endif
+	bool exists;
 
-	return type == fs::directory_file || type == fs::symlink_file;
+	// known by the file index
+	if( pResource_Manager && pResource_Manager->Find_Indexed( dir, 1, exists ) )
+	{
+		if( exists )
+		{
+			return 1;
+		}
+	}
+	else
+	{
+	// fixme : boost should use a codecvt_facet but for now we convert to UCS-2
+	#ifdef _WIN32
+		fs::file_type type = fs::status( fs::path( utf8_to_ucs2( dir ) ) ).type();
+	#else
+		fs::file_type type = fs::status( fs::path( dir ) ).type();
+	#endif
+
+		if( type == fs::directory_file || type == fs::symlink_file )
+		{
+			return 1;
+		}
+	}
+
+	// packaged
+	return pResource_Manager && pResource_Manager->Is_Package_Dir( dir );
 }
 
 bool Delete_File( const std::string &filename )
 {
 // fixme : boost should use a codecvt_facet but for now we convert to UCS-2
 #ifdef _WIN32
-	return DeleteFile( utf8_to_ucs2( filename ).c_str() ) != 0;
+	const bool deleted = DeleteFile( utf8_to_ucs2( filename ).c_str() ) != 0;
 #else
-	return remove( filename.c_str() ) == 0;
+	const bool deleted = remove( filename.c_str() ) == 0;
 #endif
+
+	if( deleted && pResource_Manager )
+	{
+		pResource_Manager->Set_Indexed_File( filename, 0 );
+	}
+
+	return deleted;
 }
 
 bool Delete_Dir( const std::string &dir )
 {
 // fixme : boost should use a codecvt_facet but for now we convert to UCS-2
 #ifdef _WIN32
-	return RemoveDirectory( utf8_to_ucs2( dir ).c_str() ) != 0;
+	const bool deleted = RemoveDirectory( utf8_to_ucs2( dir ).c_str() ) != 0;
 #else
-	return rmdir( dir.c_str() ) == 0;
+	const bool deleted = rmdir( dir.c_str() ) == 0;
 #endif
+
+	if( deleted && pResource_Manager )
+	{
+		pResource_Manager->Remove_Indexed_Dir( dir );
+	}
+
+	return deleted;
 }
 
 bool Delete_Dir_And_Content( const std::string &dir )
 {
 // fixme : boost should use a codecvt_facet but for now we convert to UCS-2
 #ifdef _WIN32
-	return fs::remove_all( fs::path( utf8_to_ucs2( dir ).c_str() ) ) > 0;
+	const bool deleted = fs::remove_all( fs::path( utf8_to_ucs2( dir ).c_str() ) ) > 0;
 #else
-	return fs::remove_all( fs::path( dir ) ) > 0;
+	const bool deleted = fs::remove_all( fs::path( dir ) ) > 0;
 #endif
+
+	if( deleted && pResource_Manager )
+	{
+		pResource_Manager->Remove_Indexed_Dir( dir );
+	}
+
+	return deleted;
 }
 
 bool Rename_File( const std::string &old_filename, const std::string &new_filename )
 {
 // fixme : boost should use a codecvt_facet but for now we convert to UCS-2
 #ifdef _WIN32
-	return MoveFileEx( utf8_to_ucs2( old_filename ).c_str(), utf8_to_ucs2( new_filename ).c_str(), MOVEFILE_REPLACE_EXISTING ) != 0;
+	const bool renamed = MoveFileEx( utf8_to_ucs2( old_filename ).c_str(), utf8_to_ucs2( new_filename ).c_str(), MOVEFILE_REPLACE_EXISTING ) != 0;
 #else
-	return rename( old_filename.c_str(), new_filename.c_str() ) == 0;
+	const bool renamed = rename( old_filename.c_str(), new_filename.c_str() ) == 0;
 #endif
+
+	if( renamed && pResource_Manager )
+	{
+		pResource_Manager->Set_Indexed_File( old_filename, 0 );
+		pResource_Manager->Set_Indexed_File( new_filename, 1 );
+	}
+
+	return renamed;
 }
 
 bool Create_Directory( const std::string &dir )
@@ -119,20 +188,34 @@ bool Create_Directory( const std::string &dir )
 
 // fixme : boost should use a codecvt_facet but for now we convert to UCS-2
 #ifdef _WIN32
-	return CreateDirectory( utf8_to_ucs2( dir ).c_str(), NULL ) != 0;
+	const bool created = CreateDirectory( utf8_to_ucs2( dir ).c_str(), NULL ) != 0;
 #else
-	return fs::create_directory( fs::path( dir ) );
+	const bool created = fs::create_directory( fs::path( dir ) );
 #endif
+
+	if( created && pResource_Manager )
+	{
+		pResource_Manager->Add_Indexed_Dir( dir );
+	}
+
+	return created;
 }
 
 bool Create_Directories( const std::string &dir )
 {
 // fixme : boost should use a codecvt_facet but for now we convert to UCS-2
 #ifdef _WIN32
-	return fs::create_directories( fs::path( utf8_to_ucs2( dir ).c_str() ) );
+	const bool created = fs::create_directories( fs::path( utf8_to_ucs2( dir ).c_str() ) );
 #else
-	return fs::create_directories( fs::path( dir ) );
+	const bool created = fs::create_directories( fs::path( dir ) );
 #endif
+
+	if( created && pResource_Manager )
+	{
+		pResource_Manager->Add_Indexed_Dir( dir );
+	}
+
+	return created;
 }
 
 size_t Get_File_Size( const std::string &filename )
@@ -169,16 +252,22 @@ void Convert_Path_Separators( std::string &str )
 	}
 }
 
-vector<std::string> Get_Directory_Files( const std::string &dir, const std::string &file_type /* = "" */, bool with_directories /* = 0 */, bool search_in_sub_directories /* = 1 */ )
+// Add the files from the file system directory
+static void Get_Loose_Directory_Files( vector<std::string> &valid_files, const std::string &dir, const std::string &file_type, bool with_directories, bool search_in_sub_directories )
 {
-	vector<std::string> valid_files;
-
 // fixme : boost should use a codecvt_facet but for now we convert to UCS-2
 #ifdef _WIN32
 	fs::path full_path( utf8_to_ucs2( dir ) );
 #else
 	fs::path full_path( dir );
 #endif
+
+	// only packaged
+	if( !fs::is_directory( full_path ) )
+	{
+		return;
+	}
+
 	fs::directory_iterator end_iter;
 
 	// load all available objects
@@ -205,8 +294,7 @@ vector<std::string> Get_Directory_Files( const std::string &dir, const std::stri
 				// load all items from the sub-directory
 				if( search_in_sub_directories )
 				{
-					vector<std::string> new_valid_files = Get_Directory_Files( dir + "/" + filename_str, file_type, with_directories );
-					valid_files.insert( valid_files.end(), new_valid_files.begin(), new_valid_files.end() );
+					Get_Loose_Directory_Files( valid_files, dir + "/" + filename_str, file_type, with_directories, 1 );
 				}
 			}
 			// valid file
@@ -220,6 +308,41 @@ vector<std::string> Get_Directory_Files( const std::string &dir, const std::stri
 			printf( "%s %s\n", dir_itr->path().string().c_str(), ex.what() );
 		}
 	}
+}
+
+vector<std::string> Get_Directory_Files( const std::string &dir, const std::string &file_type /* = "" */, bool with_directories /* = 0 */, bool search_in_sub_directories /* = 1 */ )
+{
+	vector<std::string> valid_files;
+	Get_Loose_Directory_Files( valid_files, dir, file_type, with_directories, search_in_sub_directories );
+
+	if( !pResource_Manager || !pResource_Manager->Is_Package_Open() )
+	{
+		return valid_files;
+	}
+
+	vector<std::string> packaged_files;
+	pResource_Manager->Get_Package_Files( packaged_files, dir, file_type, with_directories, search_in_sub_directories );
+
+	if( packaged_files.empty() )
+	{
+		return valid_files;
+	}
+
+	// loose files override packaged files
+	boost::unordered_set<std::string> loose_files;
+
+	for( vector<std::string>::const_iterator itr = valid_files.begin(); itr != valid_files.end(); ++itr )
+	{
+		loose_files.insert( cResource_Manager::Get_Index_Key( *itr ) );
+	}
+
+	for( vector<std::string>::const_iterator itr = packaged_files.begin(); itr != packaged_files.end(); ++itr )
+	{
+		if( loose_files.find( cResource_Manager::Get_Index_Key( *itr ) ) == loose_files.end() )
+		{
+			valid_files.push_back( *itr );
+		}
+	}
 
 	return valid_files;
 }
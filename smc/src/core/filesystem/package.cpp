@@ -0,0 +1,619 @@
+/***************************************************************************
+ * package.cpp  -  memory mapped data package
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../core/filesystem/package.h"
+#include "../../core/filesystem/filesystem.h"
+#include "../../core/filesystem/resource_manager.h"
+#include "../../core/property_helper.h"
+#include <algorithm>
+#include <cstring>
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	// memory mapping
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace SMC
+{
+
+// package identification
+static const char package_magic[8] = { 'S', 'M', 'C', 'P', 'A', 'C', 'K', '1' };
+static const Uint32 package_version = 1;
+// sizes in bytes
+static const size_t package_header_size = 32;
+static const size_t package_entry_size = 24;
+static const size_t package_data_align = 16;
+
+static inline Uint32 Read_Uint32( const unsigned char *data )
+{
+	return static_cast<Uint32>(data[0]) | ( static_cast<Uint32>(data[1]) << 8 ) | ( static_cast<Uint32>(data[2]) << 16 ) | ( static_cast<Uint32>(data[3]) << 24 );
+}
+
+static inline Uint64 Read_Uint64( const unsigned char *data )
+{
+	return static_cast<Uint64>(Read_Uint32( data )) | ( static_cast<Uint64>(Read_Uint32( data + 4 )) << 32 );
+}
+
+static void Write_Uint32( ofstream &file, Uint32 value )
+{
+	const char data[4] = { static_cast<char>(value & 0xFF), static_cast<char>(( value >> 8 ) & 0xFF), static_cast<char>(( value >> 16 ) & 0xFF), static_cast<char>(( value >> 24 ) & 0xFF) };
+	file.write( data, 4 );
+}
+
+static void Write_Uint64( ofstream &file, Uint64 value )
+{
+	Write_Uint32( file, static_cast<Uint32>(value & 0xFFFFFFFF) );
+	Write_Uint32( file, static_cast<Uint32>(value >> 32) );
+}
+
+static inline char To_Lower( char c )
+{
+	return ( c >= 'A' && c <= 'Z' ) ? static_cast<char>(c + ( 'a' - 'A' )) : c;
+}
+
+// Return true if the name starts with the prefix without case
+static bool Is_Prefix_Equal( const char *name, const std::string &prefix )
+{
+	for( size_t i = 0; i < prefix.length(); i++ )
+	{
+		if( name[i] == '\0' || To_Lower( name[i] ) != To_Lower( prefix[i] ) )
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/* *** *** *** *** *** *** cPackage *** *** *** *** *** *** *** *** *** *** *** */
+
+cPackage :: cPackage( void )
+{
+	m_data = NULL;
+	m_size = 0;
+	m_mapped = 0;
+#ifdef _WIN32
+	m_file_handle = NULL;
+	m_mapping_handle = NULL;
+#endif
+
+	m_file_count = 0;
+	m_entries = NULL;
+	m_hash_size = 0;
+	m_hash_table = NULL;
+	m_names = NULL;
+	m_names_size = 0;
+}
+
+cPackage :: ~cPackage( void )
+{
+	Close();
+}
+
+bool cPackage :: Open( const std::string &filename )
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE file_handle = CreateFile( utf8_to_ucs2( filename ).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		return 0;
+	}
+
+	LARGE_INTEGER file_size;
+
+	if( !GetFileSizeEx( file_handle, &file_size ) || file_size.QuadPart <= 0 )
+	{
+		CloseHandle( file_handle );
+		return 0;
+	}
+
+	HANDLE mapping_handle = CreateFileMapping( file_handle, NULL, PAGE_READONLY, 0, 0, NULL );
+	void *data = mapping_handle ? MapViewOfFile( mapping_handle, FILE_MAP_READ, 0, 0, 0 ) : NULL;
+
+	if( !data )
+	{
+		if( mapping_handle )
+		{
+			CloseHandle( mapping_handle );
+		}
+
+		CloseHandle( file_handle );
+		return 0;
+	}
+
+	m_file_handle = file_handle;
+	m_mapping_handle = mapping_handle;
+	m_data = static_cast<const unsigned char *>(data);
+	m_size = static_cast<size_t>(file_size.QuadPart);
+	m_mapped = 1;
+#else
+	const int file = open( filename.c_str(), O_RDONLY );
+
+	if( file < 0 )
+	{
+		return 0;
+	}
+
+	struct stat file_info;
+
+	if( fstat( file, &file_info ) != 0 || file_info.st_size <= 0 )
+	{
+		close( file );
+		return 0;
+	}
+
+	m_size = static_cast<size_t>(file_info.st_size);
+	void *data = mmap( NULL, m_size, PROT_READ, MAP_PRIVATE, file, 0 );
+
+	if( data != MAP_FAILED )
+	{
+		m_data = static_cast<const unsigned char *>(data);
+		m_mapped = 1;
+	}
+	// mapping not supported by the file system
+	else
+	{
+		unsigned char *buffer = new unsigned char[m_size];
+		size_t read_size = 0;
+
+		while( read_size < m_size )
+		{
+			const ssize_t count = read( file, buffer + read_size, m_size - read_size );
+
+			if( count <= 0 )
+			{
+				break;
+			}
+
+			read_size += static_cast<size_t>(count);
+		}
+
+		if( read_size != m_size )
+		{
+			delete[] buffer;
+			close( file );
+			m_size = 0;
+			return 0;
+		}
+
+		m_data = buffer;
+		m_mapped = 0;
+	}
+
+	// the mapping stays valid
+	close( file );
+#endif
+
+	// header
+	if( m_size < package_header_size || memcmp( m_data, package_magic, sizeof(package_magic) ) != 0 || Read_Uint32( m_data + 8 ) != package_version )
+	{
+		printf( "Error : %s is not a valid package\n", filename.c_str() );
+		Close();
+		return 0;
+	}
+
+	m_file_count = Read_Uint32( m_data + 12 );
+	m_hash_size = Read_Uint32( m_data + 16 );
+	const Uint64 table_offset = Read_Uint64( m_data + 24 );
+	const Uint64 names_offset = table_offset + static_cast<Uint64>(m_file_count) * package_entry_size + static_cast<Uint64>(m_hash_size) * 4;
+
+	// hash table size must be a power of two with free slots
+	if( !m_hash_size || ( m_hash_size & ( m_hash_size - 1 ) ) || m_hash_size <= m_file_count || table_offset < package_header_size || names_offset > m_size )
+	{
+		printf( "Error : package %s is damaged\n", filename.c_str() );
+		Close();
+		return 0;
+	}
+
+	m_entries = m_data + table_offset;
+	m_hash_table = m_entries + m_file_count * package_entry_size;
+	m_names = reinterpret_cast<const char *>(m_data + names_offset);
+	m_names_size = m_size - static_cast<size_t>(names_offset);
+
+	// check entries and collect the directories
+	for( Uint32 i = 0; i < m_file_count; i++ )
+	{
+		const unsigned char *entry = m_entries + i * package_entry_size;
+		const Uint32 name_offset = Read_Uint32( entry + 4 );
+
+		if( name_offset >= m_names_size || !memchr( m_names + name_offset, '\0', m_names_size - name_offset ) || Read_Uint64( entry + 8 ) + Read_Uint64( entry + 16 ) > table_offset )
+		{
+			printf( "Error : package %s is damaged\n", filename.c_str() );
+			Close();
+			return 0;
+		}
+
+		std::string dir = m_names + name_offset;
+
+		for( std::string::iterator itr = dir.begin(); itr != dir.end(); ++itr )
+		{
+			*itr = To_Lower( *itr );
+		}
+
+		for( size_t pos = dir.rfind( '/' ); pos != std::string::npos && pos > 0; pos = dir.rfind( '/', pos - 1 ) )
+		{
+			// parent directories already added
+			if( !m_dirs.insert( dir.substr( 0, pos ) ).second )
+			{
+				break;
+			}
+		}
+	}
+
+	for( Uint32 i = 0; i < m_hash_size; i++ )
+	{
+		if( Read_Uint32( m_hash_table + i * 4 ) > m_file_count )
+		{
+			printf( "Error : package %s is damaged\n", filename.c_str() );
+			Close();
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+void cPackage :: Close( void )
+{
+	if( m_data )
+	{
+	#ifdef _WIN32
+		UnmapViewOfFile( m_data );
+		CloseHandle( static_cast<HANDLE>(m_mapping_handle) );
+		CloseHandle( static_cast<HANDLE>(m_file_handle) );
+		m_mapping_handle = NULL;
+		m_file_handle = NULL;
+	#else
+		if( m_mapped )
+		{
+			munmap( const_cast<unsigned char *>(m_data), m_size );
+		}
+		else
+		{
+			delete[] m_data;
+		}
+	#endif
+	}
+
+	m_data = NULL;
+	m_size = 0;
+	m_mapped = 0;
+	m_file_count = 0;
+	m_entries = NULL;
+	m_hash_size = 0;
+	m_hash_table = NULL;
+	m_names = NULL;
+	m_names_size = 0;
+	m_dirs.clear();
+}
+
+const char *cPackage :: Get_File( const std::string &name, size_t &size ) const
+{
+	if( !m_data )
+	{
+		return NULL;
+	}
+
+	const Uint32 hash = Get_Name_Hash( name.c_str(), name.length() );
+	const Uint32 mask = m_hash_size - 1;
+
+	for( Uint32 slot = hash & mask, probes = 0; probes < m_hash_size; slot = ( slot + 1 ) & mask, probes++ )
+	{
+		const Uint32 index = Read_Uint32( m_hash_table + slot * 4 );
+
+		// not found
+		if( !index )
+		{
+			return NULL;
+		}
+
+		const unsigned char *entry = m_entries + ( index - 1 ) * package_entry_size;
+
+		if( Read_Uint32( entry ) != hash || !Is_Name_Equal( m_names + Read_Uint32( entry + 4 ), name.c_str(), name.length() ) )
+		{
+			continue;
+		}
+
+		size = static_cast<size_t>(Read_Uint64( entry + 16 ));
+		return reinterpret_cast<const char *>(m_data + Read_Uint64( entry + 8 ));
+	}
+
+	return NULL;
+}
+
+bool cPackage :: Dir_Exists( const std::string &name ) const
+{
+	if( !m_data )
+	{
+		return 0;
+	}
+
+	// root
+	if( name.empty() )
+	{
+		return 1;
+	}
+
+	std::string dir = name;
+
+	for( std::string::iterator itr = dir.begin(); itr != dir.end(); ++itr )
+	{
+		*itr = To_Lower( *itr );
+	}
+
+	return m_dirs.find( dir ) != m_dirs.end();
+}
+
+void cPackage :: Get_Files( vector<std::string> &files, const std::string &dir, const std::string &path, const std::string &file_type /* = "" */, bool with_directories /* = 0 */, bool search_in_sub_directories /* = 1 */ ) const
+{
+	if( !m_data )
+	{
+		return;
+	}
+
+	std::string prefix = dir;
+
+	if( !prefix.empty() )
+	{
+		prefix += '/';
+	}
+
+	// directories already added
+	boost::unordered_set<std::string> added_dirs;
+
+	for( Uint32 i = 0; i < m_file_count; i++ )
+	{
+		const char *name = Get_Entry_Name( i );
+
+		// not in the directory
+		if( strlen( name ) <= prefix.length() || !Is_Prefix_Equal( name, prefix ) )
+		{
+			continue;
+		}
+
+		const std::string relative = name + prefix.length();
+		const size_t dir_end = relative.find( '/' );
+
+		// in a sub-directory
+		if( dir_end != std::string::npos )
+		{
+			if( with_directories )
+			{
+				for( size_t pos = dir_end; pos != std::string::npos; pos = relative.find( '/', pos + 1 ) )
+				{
+					// only the first level
+					if( !search_in_sub_directories && pos != dir_end )
+					{
+						break;
+					}
+
+					const std::string sub_dir = relative.substr( 0, pos );
+
+					if( added_dirs.insert( sub_dir ).second )
+					{
+						files.push_back( path + "/" + sub_dir );
+					}
+				}
+			}
+
+			if( !search_in_sub_directories )
+			{
+				continue;
+			}
+		}
+
+		// valid file
+		if( file_type.empty() || relative.substr( relative.rfind( '/' ) + 1 ).rfind( file_type ) != std::string::npos )
+		{
+			files.push_back( path + "/" + relative );
+		}
+	}
+}
+
+int cPackage :: Create( const std::string &filename, const std::string &dir )
+{
+	vector<std::string> files = Get_Directory_Files( dir );
+	// same order on every system
+	std::sort( files.begin(), files.end() );
+
+// fixme : Check if there is a more portable way f.e. with imbue()
+#ifdef _WIN32
+	ofstream file( utf8_to_ucs2( filename ).c_str(), ios::out | ios::binary | ios::trunc );
+#else
+	ofstream file( filename.c_str(), ios::out | ios::binary | ios::trunc );
+#endif
+
+	if( !file.is_open() )
+	{
+		printf( "Error : couldn't open package %s for writing\n", filename.c_str() );
+		return -1;
+	}
+
+	// header is written when finished
+	const char header[package_header_size] = { 0 };
+	file.write( header, package_header_size );
+
+	const std::string package_key = cResource_Manager::Get_Index_Key( filename );
+
+	vector<std::string> names;
+	vector<Uint32> name_offsets;
+	vector<Uint64> data_offsets;
+	vector<Uint64> data_sizes;
+	std::string names_data;
+	Uint64 offset = package_header_size;
+	vector<char> buffer;
+
+	for( vector<std::string>::const_iterator itr = files.begin(); itr != files.end(); ++itr )
+	{
+		const std::string &path = (*itr);
+
+		// don't pack the package
+		if( cResource_Manager::Get_Index_Key( path ) == package_key )
+		{
+			continue;
+		}
+
+	#ifdef _WIN32
+		ifstream source( utf8_to_ucs2( path ).c_str(), ios::in | ios::binary );
+	#else
+		ifstream source( path.c_str(), ios::in | ios::binary );
+	#endif
+
+		if( !source.is_open() )
+		{
+			printf( "Warning : couldn't read %s for the package\n", path.c_str() );
+			continue;
+		}
+
+		source.seekg( 0, ios::end );
+		const std::streamoff size = source.tellg();
+		source.seekg( 0, ios::beg );
+
+		buffer.resize( static_cast<size_t>(size) );
+
+		if( size > 0 && !source.read( &buffer[0], size ) )
+		{
+			printf( "Warning : couldn't read %s for the package\n", path.c_str() );
+			continue;
+		}
+
+		// align file data
+		while( offset % package_data_align )
+		{
+			file.put( 0 );
+			offset++;
+		}
+
+		if( size > 0 )
+		{
+			file.write( &buffer[0], size );
+		}
+
+		names.push_back( path.substr( dir.length() + 1 ) );
+		name_offsets.push_back( static_cast<Uint32>(names_data.length()) );
+		names_data += names.back();
+		names_data += '\0';
+		data_offsets.push_back( offset );
+		data_sizes.push_back( static_cast<Uint64>(size) );
+
+		offset += static_cast<Uint64>(size);
+	}
+
+	const Uint64 table_offset = offset;
+	const Uint32 file_count = static_cast<Uint32>(names.size());
+
+	// hash table with at least half of the slots free
+	Uint32 hash_size = 16;
+
+	while( hash_size < file_count * 2 )
+	{
+		hash_size <<= 1;
+	}
+
+	vector<Uint32> hashes( file_count );
+	vector<Uint32> hash_table( hash_size, 0 );
+
+	for( Uint32 i = 0; i < file_count; i++ )
+	{
+		hashes[i] = Get_Name_Hash( names[i].c_str(), names[i].length() );
+
+		Uint32 slot = hashes[i] & ( hash_size - 1 );
+
+		while( hash_table[slot] )
+		{
+			slot = ( slot + 1 ) & ( hash_size - 1 );
+		}
+
+		hash_table[slot] = i + 1;
+	}
+
+	// entries
+	for( Uint32 i = 0; i < file_count; i++ )
+	{
+		Write_Uint32( file, hashes[i] );
+		Write_Uint32( file, name_offsets[i] );
+		Write_Uint64( file, data_offsets[i] );
+		Write_Uint64( file, data_sizes[i] );
+	}
+
+	// hash table
+	for( Uint32 i = 0; i < hash_size; i++ )
+	{
+		Write_Uint32( file, hash_table[i] );
+	}
+
+	// names
+	file.write( names_data.c_str(), names_data.length() );
+
+	// header
+	file.seekp( 0, ios::beg );
+	file.write( package_magic, sizeof(package_magic) );
+	Write_Uint32( file, package_version );
+	Write_Uint32( file, file_count );
+	Write_Uint32( file, hash_size );
+	Write_Uint32( file, 0 );
+	Write_Uint64( file, table_offset );
+
+	if( !file.good() )
+	{
+		printf( "Error : couldn't write package %s\n", filename.c_str() );
+		return -1;
+	}
+
+	return static_cast<int>(file_count);
+}
+
+Uint32 cPackage :: Get_Name_Hash( const char *name, size_t length )
+{
+	// FNV-1a
+	Uint32 hash = 2166136261U;
+
+	for( size_t i = 0; i < length; i++ )
+	{
+		hash ^= static_cast<unsigned char>(To_Lower( name[i] ));
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+bool cPackage :: Is_Name_Equal( const char *name, const char *other, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+	{
+		if( name[i] == '\0' || To_Lower( name[i] ) != To_Lower( other[i] ) )
+		{
+			return 0;
+		}
+	}
+
+	return name[length] == '\0';
+}
+
+const char *cPackage :: Get_Entry_Name( Uint32 entry ) const
+{
+	return m_names + Read_Uint32( m_entries + entry * package_entry_size + 4 );
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
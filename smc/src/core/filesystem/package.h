@@ -0,0 +1,121 @@
+/***************************************************************************
+ * package.h
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SMC_PACKAGE_H
+#define SMC_PACKAGE_H
+
+#include "../../core/global_basic.h"
+#include "SDL.h"
+#include <boost/unordered_set.hpp>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** cPackage *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Read-only archive of a directory tree
+ * The package is memory mapped and file data is returned without copying.
+ * Files are found with a hash table over the relative file names which
+ * are compared without case.
+ *
+ * Layout ( all values little endian ) :
+ * header : "SMCPACK1", version, file count, hash table size, reserved, table offset
+ * file data aligned to 16 bytes
+ * entries : name hash, name offset, data offset, data size
+ * hash table : entry index + 1 or 0 if empty
+ * names : zero terminated relative file names
+*/
+class cPackage
+{
+public:
+	cPackage( void );
+	~cPackage( void );
+
+	/* Open the package file
+	 * returns true if the package is valid
+	*/
+	bool Open( const std::string &filename );
+	// Close the package
+	void Close( void );
+
+	// Return true if a package is open
+	inline bool Is_Open( void ) const
+	{
+		return m_data != NULL;
+	}
+	// Return the amount of packaged files
+	inline unsigned int Get_File_Count( void ) const
+	{
+		return m_file_count;
+	}
+
+	/* Return the data of the file with the relative name or NULL if not packaged
+	 * the data is valid until the package is closed
+	*/
+	const char *Get_File( const std::string &name, size_t &size ) const;
+	// Return true if files with the relative directory name are packaged
+	bool Dir_Exists( const std::string &name ) const;
+	/* Add the packaged files in the relative directory
+	 * path : prefix for the returned file names
+	 * file_type : if set only this file type is returned
+	 * with_directories : if set adds directories to the returned objects
+	 * search_in_sub_directories : searches in every sub-directory
+	*/
+	void Get_Files( vector<std::string> &files, const std::string &dir, const std::string &path, const std::string &file_type = "", bool with_directories = 0, bool search_in_sub_directories = 1 ) const;
+
+	/* Write a package with all files from the directory
+	 * returns the amount of packed files or -1 on failure
+	*/
+	static int Create( const std::string &filename, const std::string &dir );
+
+private:
+	// Return the hash of the name without case
+	static Uint32 Get_Name_Hash( const char *name, size_t length );
+	// Return true if the names are equal without case
+	static bool Is_Name_Equal( const char *name, const char *other, size_t length );
+	// Return the name of the entry
+	const char *Get_Entry_Name( Uint32 entry ) const;
+
+	// package data
+	const unsigned char *m_data;
+	// package size
+	size_t m_size;
+	// if the data is memory mapped or else allocated
+	bool m_mapped;
+#ifdef _WIN32
+	// mapped file handles
+	void *m_file_handle;
+	void *m_mapping_handle;
+#endif
+
+	// file entries
+	Uint32 m_file_count;
+	const unsigned char *m_entries;
+	// entry hash table
+	Uint32 m_hash_size;
+	const unsigned char *m_hash_table;
+	// file names
+	const char *m_names;
+	size_t m_names_size;
+
+	// packaged directories without case
+	boost::unordered_set<std::string> m_dirs;
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
+
+#endif
@@ -15,7 +15,16 @@
 
 #include "../../core/filesystem/resource_manager.h"
 #include "../../core/filesystem/filesystem.h"
+#include "../../core/game_core.h"
 #include <cstdio>
+// boost filesystem
+#include "boost/filesystem/convenience.hpp"
+namespace fs = boost::filesystem;
+#ifdef __linux__
+	// file system notifications
+	#include <sys/inotify.h>
+	#include <unistd.h>
+#endif
 
 
 namespace SMC
@@ -26,11 +35,18 @@ namespace SMC
 cResource_Manager :: cResource_Manager( void )
 {
 	user_data_dir = "";
+
+	m_file_index_active = 0;
+	m_file_index_watch = 0;
+	m_index_notify_fd = -1;
+	m_index_hits = 0;
+	m_index_fallbacks = 0;
 }
 
 cResource_Manager :: ~cResource_Manager( void )
 {
-
+	Clear_File_Index();
+	Close_Package();
 }
 
 void cResource_Manager :: Init_User_Directory( void )
@@ -77,6 +93,646 @@ bool cResource_Manager :: Set_User_Directory( const std::string &dir )
 {
 	user_data_dir = dir;
 
+	// index the new user directories
+	if( m_file_index_active )
+	{
+		Refresh_File_Index();
+	}
+
+	return 1;
+}
+
+void cResource_Manager :: Init_File_Index( bool watch_changes /* = 1 */ )
+{
+	Clear_File_Index();
+
+	m_file_index_active = 1;
+	m_file_index_watch = watch_changes;
+
+	Refresh_File_Index();
+
+	if( game_debug )
+	{
+		printf( "File index : %u files and %u directories%s\n", static_cast<unsigned int>(m_index_files.size()), static_cast<unsigned int>(m_index_dirs.size()), m_index_notify_fd >= 0 ? " watched for changes" : "" );
+	}
+}
+
+void cResource_Manager :: Refresh_File_Index( void )
+{
+	if( !m_file_index_active )
+	{
+		return;
+	}
+
+#ifdef __linux__
+	if( m_index_notify_fd >= 0 )
+	{
+		close( m_index_notify_fd );
+		m_index_notify_fd = -1;
+	}
+
+	if( m_file_index_watch )
+	{
+		m_index_notify_fd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+
+		if( m_index_notify_fd < 0 )
+		{
+			printf( "Warning : Couldn't initialize file system notifications for the file index\n" );
+		}
+	}
+#endif
+
+	m_index_roots.clear();
+	m_index_files.clear();
+	m_index_dirs.clear();
+	m_index_watches.clear();
+	m_index_unwatched.clear();
+
+	// game data does not change while running
+	Add_Index_Root( DATA_DIR, 1 );
+	// user data can be changed by the game and only the checked directories are indexed
+	Add_Index_Root( user_data_dir + USER_SAVEGAME_DIR, 0 );
+	Add_Index_Root( user_data_dir + USER_SCREENSHOT_DIR, 0 );
+	Add_Index_Root( user_data_dir + USER_LEVEL_DIR, 0 );
+	Add_Index_Root( user_data_dir + USER_WORLD_DIR, 0 );
+	Add_Index_Root( user_data_dir + USER_CAMPAIGN_DIR, 0 );
+	Add_Index_Root( user_data_dir + USER_IMGCACHE_DIR, 0 );
+}
+
+void cResource_Manager :: Update_File_Index( void )
+{
+#ifdef __linux__
+	if( m_index_notify_fd < 0 )
+	{
+		return;
+	}
+
+	char buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+	bool overflow = 0;
+
+	while( 1 )
+	{
+		const ssize_t length = read( m_index_notify_fd, buffer, sizeof(buffer) );
+
+		// no more events
+		if( length <= 0 )
+		{
+			break;
+		}
+
+		for( const char *ptr = buffer; ptr < buffer + length; )
+		{
+			const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(ptr);
+			ptr += sizeof(struct inotify_event) + event->len;
+
+			// events were lost
+			if( event->mask & IN_Q_OVERFLOW )
+			{
+				overflow = 1;
+				continue;
+			}
+
+			// watch removed
+			if( event->mask & IN_IGNORED )
+			{
+				IndexWatchMap::iterator itr = m_index_watches.find( event->wd );
+
+				if( itr != m_index_watches.end() )
+				{
+					// still indexed but changes are not reported anymore
+					if( m_index_dirs.find( itr->second ) != m_index_dirs.end() )
+					{
+						m_index_unwatched.insert( itr->second );
+					}
+
+					m_index_watches.erase( itr );
+				}
+
+				continue;
+			}
+
+			IndexWatchMap::const_iterator itr = m_index_watches.find( event->wd );
+
+			// unknown or no filename
+			if( itr == m_index_watches.end() || !event->len )
+			{
+				continue;
+			}
+
+			const std::string key = Get_Index_Key( itr->second + "/" + event->name );
+
+			// created
+			if( event->mask & ( IN_CREATE | IN_MOVED_TO ) )
+			{
+				if( event->mask & IN_ISDIR )
+				{
+					Index_Directory( key );
+				}
+				else
+				{
+					m_index_files.insert( key );
+				}
+			}
+			// deleted
+			else if( event->mask & ( IN_DELETE | IN_MOVED_FROM ) )
+			{
+				if( event->mask & IN_ISDIR )
+				{
+					Remove_Indexed_Dir( key );
+				}
+				else
+				{
+					m_index_files.erase( key );
+				}
+			}
+		}
+	}
+
+	if( overflow )
+	{
+		printf( "Warning : File index notifications overflowed. Rescanning\n" );
+		Refresh_File_Index();
+	}
+#endif
+}
+
+void cResource_Manager :: Clear_File_Index( void )
+{
+#ifdef __linux__
+	if( m_index_notify_fd >= 0 )
+	{
+		close( m_index_notify_fd );
+	}
+#endif
+
+	m_index_notify_fd = -1;
+	m_file_index_active = 0;
+	m_index_roots.clear();
+	m_index_files.clear();
+	m_index_dirs.clear();
+	m_index_watches.clear();
+	m_index_unwatched.clear();
+}
+
+bool cResource_Manager :: Find_Indexed( const std::string &path, bool directory, bool &exists )
+{
+	if( !m_file_index_active )
+	{
+		return 0;
+	}
+
+	const std::string key = Get_Index_Key( path );
+	const cIndex_Root *root = Get_Index_Root( key );
+
+	// not indexed or in a hidden directory which is not indexed
+	if( !root || key.find( "/.", root->m_key.length() ) != std::string::npos )
+	{
+		m_index_fallbacks++;
+		return 0;
+	}
+
+	const IndexPathSet &paths = directory ? m_index_dirs : m_index_files;
+
+	if( paths.find( key ) != paths.end() )
+	{
+		exists = 1;
+		m_index_hits++;
+		return 1;
+	}
+
+	// known to not exist
+	if( root->m_complete || Is_Index_Watched( key ) )
+	{
+		exists = 0;
+		m_index_hits++;
+		return 1;
+	}
+
+	m_index_fallbacks++;
+	return 0;
+}
+
+void cResource_Manager :: Set_Indexed_File( const std::string &filename, bool exists )
+{
+	if( !m_file_index_active )
+	{
+		return;
+	}
+
+	const std::string key = Get_Index_Key( filename );
+
+	// not indexed
+	if( !Get_Index_Root( key ) )
+	{
+		return;
+	}
+
+	if( exists )
+	{
+		m_index_files.insert( key );
+	}
+	else
+	{
+		m_index_files.erase( key );
+	}
+}
+
+void cResource_Manager :: Add_Indexed_Dir( const std::string &dir )
+{
+	if( !m_file_index_active )
+	{
+		return;
+	}
+
+	std::string key = Get_Index_Key( dir );
+	const cIndex_Root *root = Get_Index_Root( key );
+
+	// not indexed or already known
+	if( !root || m_index_dirs.find( key ) != m_index_dirs.end() )
+	{
+		return;
+	}
+
+	// index from the first parent directory which is not known
+	while( key.length() > root->m_key.length() )
+	{
+		const size_t pos = key.rfind( '/' );
+
+		if( pos == std::string::npos || m_index_dirs.find( key.substr( 0, pos ) ) != m_index_dirs.end() )
+		{
+			break;
+		}
+
+		key.erase( pos );
+	}
+
+	Index_Directory( key );
+}
+
+void cResource_Manager :: Remove_Indexed_Dir( const std::string &dir )
+{
+	if( !m_file_index_active )
+	{
+		return;
+	}
+
+	const std::string key = Get_Index_Key( dir );
+	const std::string key_content = key + "/";
+
+	m_index_dirs.erase( key );
+
+	for( IndexPathSet::iterator itr = m_index_files.begin(); itr != m_index_files.end(); )
+	{
+		if( itr->compare( 0, key_content.length(), key_content ) == 0 )
+		{
+			itr = m_index_files.erase( itr );
+		}
+		else
+		{
+			++itr;
+		}
+	}
+
+	for( IndexPathSet::iterator itr = m_index_dirs.begin(); itr != m_index_dirs.end(); )
+	{
+		if( itr->compare( 0, key_content.length(), key_content ) == 0 )
+		{
+			itr = m_index_dirs.erase( itr );
+		}
+		else
+		{
+			++itr;
+		}
+	}
+
+	for( IndexPathSet::iterator itr = m_index_unwatched.begin(); itr != m_index_unwatched.end(); )
+	{
+		if( *itr == key || itr->compare( 0, key_content.length(), key_content ) == 0 )
+		{
+			itr = m_index_unwatched.erase( itr );
+		}
+		else
+		{
+			++itr;
+		}
+	}
+
+#ifdef __linux__
+	// stop watching
+	for( IndexWatchMap::iterator itr = m_index_watches.begin(); itr != m_index_watches.end(); )
+	{
+		if( itr->second == key || itr->second.compare( 0, key_content.length(), key_content ) == 0 )
+		{
+			inotify_rm_watch( m_index_notify_fd, itr->first );
+			itr = m_index_watches.erase( itr );
+		}
+		else
+		{
+			++itr;
+		}
+	}
+#endif
+}
+
+std::string cResource_Manager :: Get_Index_Key( const std::string &path )
+{
+	const bool absolute = !path.empty() && ( path[0] == '/' || path[0] == '\\' );
+
+	std::string key;
+	key.reserve( path.length() );
+	// parts which can be removed by ".."
+	unsigned int removable = 0;
+	size_t start = 0;
+
+	while( start <= path.length() )
+	{
+		size_t end = path.find_first_of( "/\\", start );
+
+		if( end == std::string::npos )
+		{
+			end = path.length();
+		}
+
+		const size_t length = end - start;
+
+		// empty or current directory
+		if( length == 0 || ( length == 1 && path[start] == '.' ) )
+		{
+			// ignore
+		}
+		// parent directory
+		else if( length == 2 && path[start] == '.' && path[start + 1] == '.' && removable > 0 )
+		{
+			const size_t pos = key.rfind( '/' );
+			key.erase( pos == std::string::npos ? 0 : pos );
+			removable--;
+		}
+		else
+		{
+			if( !key.empty() || absolute )
+			{
+				key += '/';
+			}
+
+			key.append( path, start, length );
+
+			if( length != 2 || path[start] != '.' || path[start + 1] != '.' )
+			{
+				removable++;
+			}
+		}
+
+		start = end + 1;
+	}
+
+	if( key.empty() && absolute )
+	{
+		key = "/";
+	}
+
+#ifdef _WIN32
+	// case insensitive file system
+	for( std::string::iterator itr = key.begin(); itr != key.end(); ++itr )
+	{
+		if( *itr >= 'A' && *itr <= 'Z' )
+		{
+			*itr += 'a' - 'A';
+		}
+	}
+#endif
+
+	return key;
+}
+
+void cResource_Manager :: Add_Index_Root( const std::string &dir, bool complete )
+{
+	const std::string key = Get_Index_Key( dir );
+
+	// not available
+	if( key.empty() || !Dir_Exists( key ) )
+	{
+		return;
+	}
+
+	m_index_roots.push_back( cIndex_Root( key, complete ) );
+	Index_Directory( key );
+}
+
+void cResource_Manager :: Index_Directory( const std::string &key )
+{
+	m_index_dirs.insert( key );
+
+#ifdef __linux__
+	if( m_index_notify_fd >= 0 )
+	{
+		const int watch = inotify_add_watch( m_index_notify_fd, key.c_str(), IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO );
+
+		if( watch < 0 )
+		{
+			printf( "Warning : Couldn't watch %s for changes. Its files are checked on the file system\n", key.c_str() );
+			m_index_unwatched.insert( key );
+		}
+		else
+		{
+			m_index_watches[watch] = key;
+		}
+	}
+#endif
+
+// fixme : boost should use a codecvt_facet but for now we convert to UCS-2
+#ifdef _WIN32
+	fs::path full_path( utf8_to_ucs2( key ) );
+#else
+	fs::path full_path( key );
+#endif
+	boost::system::error_code error;
+	fs::directory_iterator end_iter;
+
+	for( fs::directory_iterator dir_itr( full_path, error ); !error && dir_itr != end_iter; dir_itr.increment( error ) )
+	{
+		const std::string filename_str = dir_itr->path().filename().string();
+
+		if( fs::is_directory( dir_itr->status() ) )
+		{
+			// ignore hidden directories
+			if( filename_str.find( "." ) == 0 )
+			{
+				continue;
+			}
+
+			Index_Directory( Get_Index_Key( key + "/" + filename_str ) );
+		}
+		else
+		{
+			m_index_files.insert( Get_Index_Key( key + "/" + filename_str ) );
+		}
+	}
+}
+
+bool cResource_Manager :: Open_Package( const std::string &filename )
+{
+	Close_Package();
+
+	if( !m_package.Open( filename ) )
+	{
+		return 0;
+	}
+
+	m_package_root = Get_Index_Key( DATA_DIR );
+
+	if( game_debug )
+	{
+		printf( "Package : %u files from %s\n", m_package.Get_File_Count(), filename.c_str() );
+	}
+
+	return 1;
+}
+
+void cResource_Manager :: Close_Package( void )
+{
+	m_package.Close();
+	m_package_root.clear();
+}
+
+const char *cResource_Manager :: Get_Package_File( const std::string &filename, size_t &size ) const
+{
+	std::string name;
+
+	if( !Get_Package_Name( filename, name ) )
+	{
+		return NULL;
+	}
+
+	return m_package.Get_File( name, size );
+}
+
+bool cResource_Manager :: Is_Package_Dir( const std::string &dir ) const
+{
+	std::string name;
+
+	if( !Get_Package_Name( dir, name ) )
+	{
+		return 0;
+	}
+
+	return m_package.Dir_Exists( name );
+}
+
+void cResource_Manager :: Get_Package_Files( vector<std::string> &files, const std::string &dir, const std::string &file_type /* = "" */, bool with_directories /* = 0 */, bool search_in_sub_directories /* = 1 */ ) const
+{
+	std::string name;
+
+	if( !Get_Package_Name( dir, name ) )
+	{
+		return;
+	}
+
+	m_package.Get_Files( files, name, dir, file_type, with_directories, search_in_sub_directories );
+}
+
+SDL_RWops *cResource_Manager :: Open_File( const std::string &filename ) const
+{
+	// loose files override the package
+	SDL_RWops *rw = SDL_RWFromFile( filename.c_str(), "rb" );
+
+	if( rw )
+	{
+		return rw;
+	}
+
+	size_t size = 0;
+	const char *data = Get_Package_File( filename, size );
+
+	if( !data )
+	{
+		return NULL;
+	}
+
+	// read directly from the mapped package
+	return SDL_RWFromConstMem( data, static_cast<int>(size) );
+}
+
+bool cResource_Manager :: Get_Package_Name( const std::string &path, std::string &name ) const
+{
+	if( !m_package.Is_Open() )
+	{
+		return 0;
+	}
+
+	const std::string key = Get_Index_Key( path );
+
+	// packaged the current directory
+	if( m_package_root.empty() )
+	{
+		if( !key.empty() && key[0] == '/' )
+		{
+			return 0;
+		}
+
+		name = key;
+		return 1;
+	}
+
+	if( key.compare( 0, m_package_root.length(), m_package_root ) != 0 )
+	{
+		return 0;
+	}
+
+	// the package root
+	if( key.length() == m_package_root.length() )
+	{
+		name.clear();
+		return 1;
+	}
+
+	if( key[m_package_root.length()] != '/' )
+	{
+		return 0;
+	}
+
+	name = key.substr( m_package_root.length() + 1 );
+	return 1;
+}
+
+const cResource_Manager::cIndex_Root *cResource_Manager :: Get_Index_Root( const std::string &key ) const
+{
+	const cIndex_Root *best_root = NULL;
+
+	for( IndexRootList::const_iterator itr = m_index_roots.begin(); itr != m_index_roots.end(); ++itr )
+	{
+		const cIndex_Root &root = (*itr);
+
+		// the longest root containing the key
+		if( best_root && best_root->m_key.length() >= root.m_key.length() )
+		{
+			continue;
+		}
+
+		if( key.compare( 0, root.m_key.length(), root.m_key ) == 0 && ( key.length() == root.m_key.length() || key[root.m_key.length()] == '/' || root.m_key == "/" ) )
+		{
+			best_root = &root;
+		}
+	}
+
+	return best_root;
+}
+
+bool cResource_Manager :: Is_Index_Watched( const std::string &key ) const
+{
+	if( m_index_notify_fd < 0 )
+	{
+		return 0;
+	}
+
+	for( IndexPathSet::const_iterator itr = m_index_unwatched.begin(); itr != m_index_unwatched.end(); ++itr )
+	{
+		// in an unwatched directory
+		if( key.compare( 0, itr->length(), *itr ) == 0 && ( key.length() == itr->length() || key[itr->length()] == '/' ) )
+		{
+			return 0;
+		}
+	}
+
 	return 1;
 }
 
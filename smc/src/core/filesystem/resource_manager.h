@@ -18,6 +18,10 @@
 
 #include "../../core/global_basic.h"
 #include "../../core/global_game.h"
+#include "../../core/filesystem/package.h"
+#include "SDL.h"
+#include <boost/unordered_set.hpp>
+#include <boost/unordered_map.hpp>
 
 namespace SMC
 {
@@ -35,8 +39,130 @@ public:
 	// Create the necessary folders in the user directory
 	void Init_User_Directory( void );
 
+	/* Build the file index of the data directory and the user data directories
+	 * watch_changes : if set and supported the index is updated from file system notifications
+	 * without notifications files missing in the user data index are still checked on the file system
+	 * files written by the game must be added with Set_Indexed_File or Add_Indexed_Dir
+	*/
+	void Init_File_Index( bool watch_changes = 1 );
+	// Scan all indexed directories again
+	void Refresh_File_Index( void );
+	// Apply the pending file system notifications to the index
+	void Update_File_Index( void );
+	// Delete the file index and stop watching for changes
+	void Clear_File_Index( void );
+
+	/* Look up the file or directory in the index
+	 * returns 1 and sets exists if the index knows the path
+	 * returns 0 if the file system needs to be checked
+	 * pending notifications are only applied by Update_File_Index
+	*/
+	bool Find_Indexed( const std::string &path, bool directory, bool &exists );
+	// Add or remove the file from the index after it was created or deleted
+	void Set_Indexed_File( const std::string &filename, bool exists );
+	// Add the directory with its content and missing parent directories to the index after it was created
+	void Add_Indexed_Dir( const std::string &dir );
+	// Remove the directory and its content from the index after it was deleted
+	void Remove_Indexed_Dir( const std::string &dir );
+
+	// Return the path with unified separators and without "." and ".." parts as used by the index
+	static std::string Get_Index_Key( const std::string &path );
+
+	// Return the amount of lookups answered by the index
+	inline unsigned int Get_Index_Hits( void ) const
+	{
+		return m_index_hits;
+	}
+	// Return the amount of lookups which needed a file system check
+	inline unsigned int Get_Index_Fallbacks( void ) const
+	{
+		return m_index_fallbacks;
+	}
+
+	/* Open the package with the files of the data directory
+	 * loose files in the data directory are used instead of packaged files with the same name
+	*/
+	bool Open_Package( const std::string &filename );
+	// Close the package
+	void Close_Package( void );
+	// Return true if a package is open
+	inline bool Is_Package_Open( void ) const
+	{
+		return m_package.Is_Open();
+	}
+
+	/* Return the packaged data of the file or NULL if not packaged
+	 * the data is valid until the package is closed
+	*/
+	const char *Get_Package_File( const std::string &filename, size_t &size ) const;
+	// Return true if the directory contains packaged files
+	bool Is_Package_Dir( const std::string &dir ) const;
+	// Add the packaged files in the directory like Get_Directory_Files
+	void Get_Package_Files( vector<std::string> &files, const std::string &dir, const std::string &file_type = "", bool with_directories = 0, bool search_in_sub_directories = 1 ) const;
+	/* Open the file for reading from the file system or else from the package
+	 * returns NULL if not found
+	*/
+	SDL_RWops *Open_File( const std::string &filename ) const;
+
 	// user data directory
 	std::string user_data_dir;
+
+private:
+	// Set the name relative to the package root and return true if the path is inside the package
+	bool Get_Package_Name( const std::string &path, std::string &name ) const;
+
+	// Directory tree in the index
+	class cIndex_Root
+	{
+	public:
+		cIndex_Root( const std::string &key, bool complete )
+		: m_key( key ), m_complete( complete ) {};
+
+		// index key of the directory
+		std::string m_key;
+		// if files missing in the index do not exist
+		bool m_complete;
+	};
+
+	typedef vector<cIndex_Root> IndexRootList;
+	typedef boost::unordered_set<std::string> IndexPathSet;
+	typedef boost::unordered_map<int, std::string> IndexWatchMap;
+
+	// Add a root directory and scan it
+	void Add_Index_Root( const std::string &dir, bool complete );
+	// Add the directory with its content to the index
+	void Index_Directory( const std::string &key );
+	// Return the root containing the key or NULL if not indexed
+	const cIndex_Root *Get_Index_Root( const std::string &key ) const;
+	// Return true if the key is watched for changes
+	bool Is_Index_Watched( const std::string &key ) const;
+
+	// if the file index is initialized
+	bool m_file_index_active;
+	// if file system notifications should be used
+	bool m_file_index_watch;
+	// indexed root directories
+	IndexRootList m_index_roots;
+	// indexed files
+	IndexPathSet m_index_files;
+	// indexed directories
+	IndexPathSet m_index_dirs;
+	// notification handle or -1 if not watching
+	int m_index_notify_fd;
+	// watched directory by notification watch descriptor
+	IndexWatchMap m_index_watches;
+	// directories which could not be watched and are checked on the file system with their content
+	IndexPathSet m_index_unwatched;
+
+	// lookups answered by the index
+	unsigned int m_index_hits;
+	// lookups which needed a file system check
+	unsigned int m_index_fallbacks;
+
+	// data package
+	cPackage m_package;
+	// index key of the packaged directory
+	std::string m_package_root;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
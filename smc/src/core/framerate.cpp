@@ -40,6 +40,7 @@ void cPerformance_Timer :: Reset( void )
 	frame_counter = 0;
 	ms_counter = 0;
 	ms = 0;
+	last_ms = 0;
 }
 
 void cPerformance_Timer :: Update( void )
@@ -49,7 +50,8 @@ void cPerformance_Timer :: Update( void )
 
 	// add milliseconds
 	Uint32 new_ticks = SDL_GetTicks();
-	ms_counter += new_ticks - pFramerate->m_perf_last_ticks;
+	last_ms = new_ticks - pFramerate->m_perf_last_ticks;
+	ms_counter += last_ms;
 	pFramerate->m_perf_last_ticks = new_ticks;
 
 	// counted 100 frames
@@ -172,6 +174,12 @@ void cFramerate :: Update( void )
 	}
 
 	m_last_ticks = current_ticks;
+
+	// clear the frame times
+	for( Performance_Timer_List::iterator itr = m_perf_timer.begin(); itr != m_perf_timer.end(); ++itr )
+	{
+		(*itr)->last_ms = 0;
+	}
 }
 
 void cFramerate :: Reset( void )
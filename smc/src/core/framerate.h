@@ -43,6 +43,8 @@ public:
 	Uint32 ms_counter;
 	// milliseconds per 100 frames
 	Uint32 ms;
+	// milliseconds in the current frame or 0 if not updated
+	Uint32 last_ms;
 };
 
 /* *** *** *** *** *** *** *** cFramerate *** *** *** *** *** *** *** *** *** *** */
@@ -343,20 +343,8 @@ void Clear_Input_Events( void )
 	pJoystick->Reset_keys();
 }
 
-void Preload_Images( bool draw_gui /* = 0 */ )
+vector<std::string> Get_Preload_Image_Files( void )
 {
-	// progress bar
-	CEGUI::ProgressBar *progress_bar = NULL;
-
-	if( draw_gui )
-	{
-		// get progress bar
-		progress_bar = static_cast<CEGUI::ProgressBar *>(CEGUI::WindowManager::getSingleton().getWindow( "progress_bar" ));
-		progress_bar->setProgress( 0 );
-		// set loading screen text
-		Loading_Screen_Draw_Text( _("Loading Images") );
-	}
-
 	// image files
 	vector<std::string> image_files;
 
@@ -458,6 +446,29 @@ void Preload_Images( bool draw_gui /* = 0 */ )
 	image_files.push_back( "game/gold_m.png" );
 	image_files.push_back( "game/itembox.png" );
 
+	return image_files;
+}
+
+void Preload_Images( bool draw_gui /* = 0 */ )
+{
+	// progress bar
+	CEGUI::ProgressBar *progress_bar = NULL;
+
+	if( draw_gui )
+	{
+		// get progress bar
+		progress_bar = static_cast<CEGUI::ProgressBar *>(CEGUI::WindowManager::getSingleton().getWindow( "progress_bar" ));
+		progress_bar->setProgress( 0 );
+		// set loading screen text
+		Loading_Screen_Draw_Text( _("Loading Images") );
+	}
+
+	// wait for the images decoded in the background
+	pVideo->Wait_Image_Decode();
+
+	// image files
+	vector<std::string> image_files = Get_Preload_Image_Files();
+
 	unsigned int loaded_files = 0;
 	unsigned int file_count = image_files.size();
 
@@ -481,28 +492,13 @@ void Preload_Images( bool draw_gui /* = 0 */ )
 			Loading_Screen_Draw();
 		}
 	}
+
+	// free the decoded images which were not used
+	pVideo->Clear_Decoded_Images();
 }
 
-void Preload_Sounds( bool draw_gui /* = 0 */ )
+vector<std::string> Get_Preload_Sound_Files( void )
 {
-	// skip caching if disabled
-	if( !pAudio->m_sound_enabled )
-	{
-		return;
-	}
-
-	// progress bar
-	CEGUI::ProgressBar *progress_bar = NULL;
-
-	if( draw_gui )
-	{
-		// get progress bar
-		progress_bar = static_cast<CEGUI::ProgressBar *>(CEGUI::WindowManager::getSingleton().getWindow( "progress_bar" ));
-		progress_bar->setProgress( 0 );
-		// set loading screen text
-		Loading_Screen_Draw_Text( _("Loading Sounds") );
-	}
-
 	// sound files
 	vector<std::string> sound_files;
 
@@ -590,6 +586,35 @@ void Preload_Sounds( bool draw_gui /* = 0 */ )
 	// overworld
 	sound_files.push_back( "waypoint_reached.ogg" );
 
+	return sound_files;
+}
+
+void Preload_Sounds( bool draw_gui /* = 0 */ )
+{
+	// skip caching if disabled
+	if( !pAudio->m_sound_enabled )
+	{
+		return;
+	}
+
+	// progress bar
+	CEGUI::ProgressBar *progress_bar = NULL;
+
+	if( draw_gui )
+	{
+		// get progress bar
+		progress_bar = static_cast<CEGUI::ProgressBar *>(CEGUI::WindowManager::getSingleton().getWindow( "progress_bar" ));
+		progress_bar->setProgress( 0 );
+		// set loading screen text
+		Loading_Screen_Draw_Text( _("Loading Sounds") );
+	}
+
+	// add the sounds loaded in the background
+	pAudio->Finish_Sound_Decode();
+
+	// sound files
+	vector<std::string> sound_files = Get_Preload_Sound_Files();
+
 	unsigned int loaded_files = 0;
 	unsigned int file_count = sound_files.size();
 
@@ -92,6 +92,11 @@ void Enter_Game_Mode( const GameMode new_mode );
 // Clear the complete input event queue
 void Clear_Input_Events( void ); 
 
+// Return the common images loaded by Preload_Images
+vector<std::string> Get_Preload_Image_Files( void );
+// Return the common sounds loaded by Preload_Sounds
+vector<std::string> Get_Preload_Sound_Files( void );
+
 /* Preload the common images into the image manager
  * draw_gui : if set use the loading screen gui for drawing
  */
@@ -188,6 +188,8 @@ enum LevelLandType
 #define GAME_ICON_DIR "icon"
 #define GAME_SCHEMA_DIR "schema"
 #define GAME_TRANSLATION_DIR "translations"
+// data package in the data directory
+#define GAME_PACKAGE_FILE "data.smcpak"
 // GUI
 #define GUI_SCHEME_DIR "gui/schemes"
 #define GUI_IMAGESET_DIR "gui/imagesets"
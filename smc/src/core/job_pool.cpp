@@ -0,0 +1,139 @@
+/***************************************************************************
+ * job_pool.cpp  -  Worker threads for splitting work
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/job_pool.h"
+// boost bind
+#include <boost/bind.hpp>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** cJob_Pool *** *** *** *** *** *** *** *** *** *** */
+
+cJob_Pool :: cJob_Pool( unsigned int thread_count )
+{
+	m_count = 0;
+	m_range_size = 1;
+	m_next = 0;
+	m_finished = 0;
+	m_exit = 0;
+
+	for( unsigned int i = 0; i < thread_count; i++ )
+	{
+		m_threads.push_back( new boost::thread( boost::bind( &cJob_Pool::Work, this ) ) );
+	}
+}
+
+cJob_Pool :: ~cJob_Pool( void )
+{
+	{
+		boost::unique_lock<boost::mutex> lock( m_mutex );
+		m_exit = 1;
+	}
+
+	m_job_condition.notify_all();
+
+	for( vector<boost::thread *>::iterator itr = m_threads.begin(); itr != m_threads.end(); ++itr )
+	{
+		(*itr)->join();
+		delete *itr;
+	}
+
+	m_threads.clear();
+}
+
+void cJob_Pool :: Run( const Job &job, unsigned int count, unsigned int range_size )
+{
+	if( !count )
+	{
+		return;
+	}
+
+	// not worth splitting
+	if( m_threads.empty() || count <= range_size )
+	{
+		job( 0, count );
+		return;
+	}
+
+	boost::unique_lock<boost::mutex> lock( m_mutex );
+
+	m_job = job;
+	m_count = count;
+	m_range_size = range_size;
+	m_next = 0;
+	m_finished = 0;
+
+	m_job_condition.notify_all();
+
+	// work on it too
+	Run_Ranges( lock );
+
+	while( m_finished < m_count )
+	{
+		m_done_condition.wait( lock );
+	}
+
+	// workers wait for the next job
+	m_job = Job();
+	m_count = 0;
+	m_next = 0;
+	m_finished = 0;
+}
+
+void cJob_Pool :: Work( void )
+{
+	boost::unique_lock<boost::mutex> lock( m_mutex );
+
+	while( !m_exit )
+	{
+		if( m_next >= m_count )
+		{
+			m_job_condition.wait( lock );
+			continue;
+		}
+
+		Run_Ranges( lock );
+	}
+}
+
+void cJob_Pool :: Run_Ranges( boost::unique_lock<boost::mutex> &lock )
+{
+	while( m_next < m_count )
+	{
+		const unsigned int start = m_next;
+		const unsigned int end = m_count - start > m_range_size ? start + m_range_size : m_count;
+		m_next = end;
+
+		lock.unlock();
+		m_job( start, end );
+		lock.lock();
+
+		m_finished += end - start;
+
+		if( m_finished >= m_count )
+		{
+			m_done_condition.notify_all();
+		}
+	}
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cJob_Pool *pJob_Pool = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
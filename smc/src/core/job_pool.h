@@ -0,0 +1,98 @@
+/***************************************************************************
+ * job_pool.h
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SMC_JOB_POOL_H
+#define SMC_JOB_POOL_H
+
+#include "../core/global_basic.h"
+#include <boost/function.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** cJob_Pool *** *** *** *** *** *** *** *** *** *** */
+
+/* Worker threads which split an index range between them
+ * the calling thread also works on the range and waits until all are finished
+*/
+class cJob_Pool
+{
+public:
+	// job called with the start index and the end index which is not included
+	typedef boost::function<void (unsigned int, unsigned int)> Job;
+
+	/* thread_count : worker threads in addition to the calling thread
+	 * if 0 every job runs on the calling thread
+	*/
+	cJob_Pool( unsigned int thread_count );
+	~cJob_Pool( void );
+
+	/* Run the job for all indexes from 0 to count and wait until it is finished
+	 * range_size : indexes handled by one call to the job
+	 * if count is not bigger than range_size the job runs on the calling thread only
+	*/
+	void Run( const Job &job, unsigned int count, unsigned int range_size );
+
+	// Return the worker thread count
+	inline unsigned int Get_Thread_Count( void ) const
+	{
+		return static_cast<unsigned int>(m_threads.size());
+	}
+
+private:
+	// Worker thread loop
+	void Work( void );
+	/* Run the remaining ranges of the current job
+	 * lock : locked job mutex which is unlocked while running the job
+	*/
+	void Run_Ranges( boost::unique_lock<boost::mutex> &lock );
+
+	// worker threads
+	vector<boost::thread *> m_threads;
+
+	// protects all job data
+	boost::mutex m_mutex;
+	// signals a new job or exit to the workers
+	boost::condition_variable m_job_condition;
+	// signals the end of the job to the calling thread
+	boost::condition_variable m_done_condition;
+
+	// current job
+	Job m_job;
+	// index count of the current job
+	unsigned int m_count;
+	// indexes handled by one call
+	unsigned int m_range_size;
+	// next index to hand out
+	unsigned int m_next;
+	// finished indexes
+	unsigned int m_finished;
+	// if the workers should exit
+	bool m_exit;
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Job pool for the update of all objects
+extern cJob_Pool *pJob_Pool;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
+
+#endif
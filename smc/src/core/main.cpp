@@ -35,8 +35,11 @@
 #include "../user/savegame.h"
 #include "../input/keyboard.h"
 #include "../video/renderer.h"
+#include "../video/img_set.h"
+#include "../core/job_pool.h"
 #include "../core/i18n.h"
 #include "../gui/generic.h"
+#include "../core/math/utilities.h"
 
 #ifdef __APPLE__
 // needed for datapath detection
@@ -47,6 +50,9 @@
 // CEGUI
 #include "CEGUIDefaultLogger.h"
 
+// boost date_time
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
 // SMC namespace is set later to exclude main() from it
 using namespace SMC;
 
@@ -57,6 +63,35 @@ using namespace SMC;
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
+// random seed given on the command line
+static Uint32 random_seed_argument = 0;
+static bool random_seed_argument_set = 0;
+
+// time of the last finished startup step
+static boost::posix_time::ptime startup_step_time;
+// finished startup steps with the needed time in milliseconds
+static vector<std::pair<std::string, long> > startup_steps;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Record the time needed since the last startup step if the performance debug mode is enabled
+static void Startup_Step_Done( const std::string &name )
+{
+	if( !game_debug_performance )
+	{
+		return;
+	}
+
+	const boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+
+	startup_steps.push_back( std::pair<std::string, long>( name, static_cast<long>((now - startup_step_time).total_milliseconds()) ) );
+	startup_step_time = now;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// the test program has its own main function
+#ifndef SMC_TEST
 int main( int argc, char **argv )
 {
 // todo : remove this apple hack
@@ -119,6 +154,8 @@ int main( int argc, char **argv )
 				printf( "-d, --debug\tEnable debug modes with the options : game performance\n" );
 				printf( "-l, --level\tLoad the given level\n" );
 				printf( "-w, --world\tLoad the given world\n" );
+				printf( "-s, --seed\tSet the random number seed\n" );
+				printf( "-p, --pack\tWrite the data directory into the given package file\n" );
 				return EXIT_SUCCESS;
 			}
 			// version
@@ -159,6 +196,41 @@ int main( int argc, char **argv )
 					}
 				}
 			}
+			// random seed
+			else if( arguments[i] == "--seed" || arguments[i] == "-s" )
+			{
+				// no valid value
+				if( i + 1 >= arguments.size() || !Is_Valid_Number( arguments[i + 1], 0 ) )
+				{
+					printf( "%s requires a number\n", arguments[i].c_str() );
+					return EXIT_FAILURE;
+				}
+
+				random_seed_argument = static_cast<Uint32>(string_to_long( arguments[i + 1] ));
+				random_seed_argument_set = 1;
+				// skip value
+				i++;
+			}
+			// write data package
+			else if( arguments[i] == "--pack" || arguments[i] == "-p" )
+			{
+				// no value
+				if( i + 1 >= arguments.size() )
+				{
+					printf( "%s requires a filename\n", arguments[i].c_str() );
+					return EXIT_FAILURE;
+				}
+
+				const int file_count = cPackage::Create( arguments[i + 1], DATA_DIR );
+
+				if( file_count < 0 )
+				{
+					return EXIT_FAILURE;
+				}
+
+				printf( "Packed %d files into %s\n", file_count, arguments[i + 1].c_str() );
+				return EXIT_SUCCESS;
+			}
 			// level loading is handled later
 			else if( arguments[i] == "--level" || arguments[i] == "-l" )
 			{
@@ -217,6 +289,8 @@ int main( int argc, char **argv )
 	// game loop
 	while( !game_exit )
 	{
+		// apply file changes
+		pResource_Manager->Update_File_Index();
 		// update
 		Update_Game();
 		// draw
@@ -236,6 +310,7 @@ int main( int argc, char **argv )
 	Exit_Game();
 	return EXIT_SUCCESS;
 }
+#endif
 
 // namespace is set here to exclude main() from it
 namespace SMC
@@ -243,8 +318,23 @@ namespace SMC
 
 void Init_Game( void )
 {
+	const boost::posix_time::ptime startup_time = boost::posix_time::microsec_clock::universal_time();
+	startup_step_time = startup_time;
+
 	// init random number generator
-	srand( static_cast<unsigned int>(time( NULL )) );
+	if( random_seed_argument_set )
+	{
+		Set_Random_Seed( random_seed_argument );
+	}
+	else
+	{
+		Set_Random_Seed( static_cast<Uint32>(time( NULL )) );
+	}
+
+	if( game_debug )
+	{
+		printf( "Random seed : %u\n", Get_Random_Seed() );
+	}
 
 	// Init Stage 1 - core classes
 	pResource_Manager = new cResource_Manager();
@@ -256,14 +346,22 @@ void Init_Game( void )
 	pRenderer_current = new cRenderQueue( 200 );
 	pPreferences = new cPreferences();
 	pImage_Manager = new cImage_Manager();
+	pImage_Set_Manager = new cImage_Set_Manager();
 	pSound_Manager = new cSound_Manager();
 	pSettingsParser = new cImage_Settings_Parser();
+	// one worker less than the processors as the main thread also works on the jobs
+	pJob_Pool = new cJob_Pool( boost::thread::hardware_concurrency() > 1 ? boost::thread::hardware_concurrency() - 1 : 0 );
 
 	// Init Stage 2 - set preferences and init audio and the video screen
 	/* Set default user directory
 	 * can get overridden later from the preferences
 	*/
 	pResource_Manager->Set_User_Directory( Get_User_Directory() );
+	// use the data package if available
+	if( File_Exists( DATA_DIR "/" GAME_PACKAGE_FILE ) )
+	{
+		pResource_Manager->Open_Package( DATA_DIR "/" GAME_PACKAGE_FILE );
+	}
 	/* Initialize the fake CEGUI renderer and system for the pPreferences XMLParser,
 	 * because CEGUI creates the system normally with the OpenGL-Renderer and OpenGL calls may 
 	 * only be made with a valid OpenGL-context, which we would get only by setting 
@@ -281,19 +379,32 @@ void Init_Game( void )
 	I18N_Init();
 	// delete CEGUI System fake
 	pVideo->Delete_CEGUI_Fake();
+	Startup_Step_Done( "preferences" );
 
 	// init user dir directory
 	pResource_Manager->Init_User_Directory();
+	// index data and user files
+	pResource_Manager->Init_File_Index();
+	Startup_Step_Done( "file index" );
 	// video init
 	pVideo->Init_SDL();
+	// decode the common images while OpenGL and CEGUI are initialized
+	pVideo->Start_Image_Decode( Get_Preload_Image_Files() );
+	Startup_Step_Done( "SDL" );
 	pVideo->Init_Video();
+	Startup_Step_Done( "video" );
 	pVideo->Init_CEGUI();
 	pVideo->Init_CEGUI_Data();
 	pFont->Init();
+	Startup_Step_Done( "CEGUI" );
 	// framerate init ( must be after SDL init because of SDL_GetTicks() )
 	pFramerate->Init();
 	// audio init
 	pAudio->Init();
+	pSound_Manager->Load_Priorities( DATA_DIR "/" GAME_SOUNDS_DIR "/priority.txt" );
+	// load the common sounds while the game classes are created
+	pAudio->Start_Sound_Decode( Get_Preload_Sound_Files() );
+	Startup_Step_Done( "audio" );
 
 	pCampaign_Manager = new cCampaign_Manager();
 	pLevel_Player = new cLevel_Player( NULL );
@@ -313,6 +424,7 @@ void Init_Game( void )
 	Loading_Screen_Init();
 	// initialize image cache
 	pVideo->Init_Image_Cache( 0, 1 );
+	Startup_Step_Done( "image cache" );
 
 	// Init Stage 3 - game classes
 	// note : set any sprite manager as it is set again on game mode switch
@@ -336,11 +448,27 @@ void Init_Game( void )
 	pHud_Manager->Load();
 	pMenuCore = new cMenuCore();
 	pSavegame = new cSavegame();
+	pParticle_Effects = new cParticle_Effect_Templates();
+	pParticle_Effects->Init();
+	Startup_Step_Done( "game classes" );
 
 	// cache
 	Preload_Images( 1 );
+	Startup_Step_Done( "images" );
 	Preload_Sounds( 1 );
+	Startup_Step_Done( "sounds" );
 	Loading_Screen_Exit();
+
+	if( game_debug_performance )
+	{
+		for( vector<std::pair<std::string, long> >::const_iterator itr = startup_steps.begin(); itr != startup_steps.end(); ++itr )
+		{
+			printf( "Startup : %s %ld ms\n", itr->first.c_str(), itr->second );
+		}
+
+		printf( "Startup : total %ld ms\n", static_cast<long>((boost::posix_time::microsec_clock::universal_time() - startup_time).total_milliseconds()) );
+		startup_steps.clear();
+	}
 }
 
 void Exit_Game( void )
@@ -449,6 +577,12 @@ void Exit_Game( void )
 		pMenuCore = NULL;
 	}
 
+	if( pParticle_Effects )
+	{
+		delete pParticle_Effects;
+		pParticle_Effects = NULL;
+	}
+
 	if( pRenderer )
 	{
 		delete pRenderer;
@@ -483,6 +617,18 @@ void Exit_Game( void )
 		pVideo = NULL;
 	}
 
+	if( pImage_Set_Manager )
+	{
+		delete pImage_Set_Manager;
+		pImage_Set_Manager = NULL;
+	}
+
+	if( pJob_Pool )
+	{
+		delete pJob_Pool;
+		pJob_Pool = NULL;
+	}
+
 	if( pImage_Manager )
 	{
 		delete pImage_Manager;
@@ -696,6 +842,7 @@ void Update_Game( void )
 	else if( Game_Mode == MODE_OVERWORLD )
 	{
 		pActive_Overworld->Update();
+		pOverworld_Manager->Update();
 	}
 	else if( Game_Mode == MODE_MENU )
 	{
@@ -0,0 +1,100 @@
+/***************************************************************************
+ * random.cpp  -  Pseudo random number generation
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../core/math/random.h"
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** *** cRandom_Generator *** *** *** *** *** *** *** *** *** */
+
+// splitmix32 step used to expand a seed into a full state
+static Uint32 Random_Split_Mix( Uint32 &value )
+{
+	value += 0x9E3779B9;
+	Uint32 z = value;
+	z = ( z ^ ( z >> 16 ) ) * 0x85EBCA6B;
+	z = ( z ^ ( z >> 13 ) ) * 0xC2B2AE35;
+	return z ^ ( z >> 16 );
+}
+
+cRandom_Generator :: cRandom_Generator( void )
+{
+	Set_Seed( 0 );
+}
+
+void cRandom_Generator :: Set_Seed( Uint32 seed )
+{
+	for( unsigned int i = 0; i < 4; i++ )
+	{
+		m_state[i] = Random_Split_Mix( seed );
+	}
+
+	// an all zero state would only return zero
+	if( !m_state[0] && !m_state[1] && !m_state[2] && !m_state[3] )
+	{
+		m_state[0] = 1;
+	}
+}
+
+void cRandom_Generator :: Fill_Float( float *values, unsigned int count, float min, float max )
+{
+	const float range = ( max - min ) * ( 1.0f / 16777216.0f );
+
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		values[i] = min + ( static_cast<float>( Get_Uint32() >> 8 ) * range );
+	}
+}
+
+void cRandom_Generator :: Add_Float( float *values, unsigned int count, float range )
+{
+	range *= 1.0f / 16777216.0f;
+
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		values[i] += static_cast<float>( Get_Uint32() >> 8 ) * range;
+	}
+}
+
+/* *** *** *** *** *** *** *** *** Random functions *** *** *** *** *** *** *** *** *** */
+
+static cRandom_Generator random_streams[RANDOM_STREAM_AMOUNT];
+static Uint32 random_seed = 0;
+
+void Set_Random_Seed( Uint32 seed )
+{
+	random_seed = seed;
+
+	for( unsigned int i = 0; i < RANDOM_STREAM_AMOUNT; i++ )
+	{
+		// mix the stream number into the seed
+		random_streams[i].Set_Seed( seed ^ ( ( i + 1 ) * 0x632BE5AB ) );
+	}
+}
+
+Uint32 Get_Random_Seed( void )
+{
+	return random_seed;
+}
+
+cRandom_Generator &Get_Random_Generator( RandomStream stream /* = RANDOM_STREAM_GAMEPLAY */ )
+{
+	return random_streams[stream];
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
@@ -0,0 +1,127 @@
+/***************************************************************************
+ * random.h
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SMC_RANDOM_H
+#define SMC_RANDOM_H
+
+#include "../../core/global_basic.h"
+// SDL
+#include "SDL.h"
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** *** Random streams *** *** *** *** *** *** *** *** *** */
+
+/* Every subsystem uses its own stream
+ * so drawing or audio randomness does not change the gameplay values
+*/
+enum RandomStream
+{
+	// enemies, objects and the player
+	RANDOM_STREAM_GAMEPLAY = 0,
+	// particle emitters and animations
+	RANDOM_STREAM_PARTICLE = 1,
+	// sounds
+	RANDOM_STREAM_AUDIO = 2,
+	// menus, screen effects and other values only used for drawing
+	RANDOM_STREAM_VISUAL = 3,
+	RANDOM_STREAM_AMOUNT = 4
+};
+
+/* *** *** *** *** *** *** *** *** cRandom_Generator *** *** *** *** *** *** *** *** *** */
+
+/* xoshiro128** pseudo random number generator
+ * fast, small state and good quality in all bits
+*/
+class cRandom_Generator
+{
+public:
+	cRandom_Generator( void );
+
+	// Set the state from the given seed
+	void Set_Seed( Uint32 seed );
+
+	// Return the next random value
+	inline Uint32 Get_Uint32( void )
+	{
+		const Uint32 result = Rotate_Left( m_state[1] * 5, 7 ) * 9;
+		const Uint32 t = m_state[1] << 9;
+
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= t;
+		m_state[3] = Rotate_Left( m_state[3], 11 );
+
+		return result;
+	}
+
+	// Return a random value from 0 to max - 1 or 0 if max is 0
+	inline unsigned int Get_Int( unsigned int max )
+	{
+		return static_cast<unsigned int>( ( static_cast<Uint64>( Get_Uint32() ) * max ) >> 32 );
+	}
+
+	// Return a random value from min to max
+	inline float Get_Float( float min, float max )
+	{
+		// use the upper 24 bits which fit exactly into the float mantissa
+		return min + ( max - min ) * ( static_cast<float>( Get_Uint32() >> 8 ) * ( 1.0f / 16777216.0f ) );
+	}
+
+	// Fill the array with random values from min to max
+	void Fill_Float( float *values, unsigned int count, float min, float max );
+	// Add random values from 0 to range to the array
+	void Add_Float( float *values, unsigned int count, float range );
+
+private:
+	static inline Uint32 Rotate_Left( const Uint32 x, const int k )
+	{
+		return ( x << k ) | ( x >> ( 32 - k ) );
+	}
+
+	Uint32 m_state[4];
+};
+
+/* *** *** *** *** *** *** *** *** Random functions *** *** *** *** *** *** *** *** *** */
+
+/* Seed all random streams
+ * every stream gets a different state derived from the seed
+*/
+void Set_Random_Seed( Uint32 seed );
+// Return the last set seed
+Uint32 Get_Random_Seed( void );
+// Return the generator of the stream
+cRandom_Generator &Get_Random_Generator( RandomStream stream = RANDOM_STREAM_GAMEPLAY );
+
+// return a random value from 0 to max - 1 or 0 if max is 0
+inline unsigned int Get_Random_Int( unsigned int max, RandomStream stream = RANDOM_STREAM_GAMEPLAY )
+{
+	return Get_Random_Generator( stream ).Get_Int( max );
+}
+
+// return a random floating point value between the given values
+inline float Get_Random_Float( float min, float max, RandomStream stream = RANDOM_STREAM_GAMEPLAY )
+{
+	return Get_Random_Generator( stream ).Get_Float( min, max );
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
+
+#endif
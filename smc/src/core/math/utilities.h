@@ -18,8 +18,7 @@
 
 #include "../../core/global_basic.h"
 #include "../../core/global_game.h"
-// for rand()
-#include <cstdlib>
+#include "../../core/math/random.h"
 
 namespace SMC
 {
@@ -40,12 +39,6 @@ template<class T> inline T Clamp( const T &v, const T &min, const T &max )
 	return v;
 }
 
-// return a random floating point value between the given values
-inline float Get_Random_Float( float min, float max )
-{
-	return min + (max - min) * static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-}
-
 // Checks if number is power of 2 and if not returns the next power of two size
 inline unsigned int Get_Power_of_2( unsigned int size )
 {
@@ -0,0 +1,111 @@
+/***************************************************************************
+ * memory_pool.cpp  -  fixed size memory pool
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/memory_pool.h"
+// for operator new
+#include <new>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** cMemory_Pool *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cMemory_Pool :: cMemory_Pool( size_t item_size, unsigned int block_items /* = 256 */ )
+{
+	// every free item stores the pointer to the next free item
+	if( item_size < sizeof(void *) )
+	{
+		item_size = sizeof(void *);
+	}
+
+	// keep the items aligned
+	const size_t align = sizeof(double) > sizeof(void *) ? sizeof(double) : sizeof(void *);
+	m_item_size = ( ( item_size + align - 1 ) / align ) * align;
+
+	m_block_items = block_items ? block_items : 1;
+	m_free_list = NULL;
+	m_used_count = 0;
+	m_allocation_count = 0;
+}
+
+cMemory_Pool :: ~cMemory_Pool( void )
+{
+	for( BlockList::iterator itr = m_blocks.begin(); itr != m_blocks.end(); ++itr )
+	{
+		delete[] *itr;
+	}
+
+	m_blocks.clear();
+}
+
+void *cMemory_Pool :: Allocate( size_t size )
+{
+	// too large for this pool
+	if( size > m_item_size )
+	{
+		return ::operator new( size );
+	}
+
+	if( !m_free_list )
+	{
+		Add_Block();
+	}
+
+	void *item = m_free_list;
+	m_free_list = *static_cast<void **>(item);
+
+	m_used_count++;
+	m_allocation_count++;
+
+	return item;
+}
+
+void cMemory_Pool :: Release( void *ptr, size_t size )
+{
+	if( !ptr )
+	{
+		return;
+	}
+
+	// not from this pool
+	if( size > m_item_size )
+	{
+		::operator delete( ptr );
+		return;
+	}
+
+	*static_cast<void **>(ptr) = m_free_list;
+	m_free_list = ptr;
+
+	m_used_count--;
+}
+
+void cMemory_Pool :: Add_Block( void )
+{
+	char *block = new char[m_item_size * m_block_items];
+	m_blocks.push_back( block );
+
+	// link the items in memory order
+	for( unsigned int i = m_block_items; i > 0; i-- )
+	{
+		void *item = block + ( m_item_size * ( i - 1 ) );
+		*static_cast<void **>(item) = m_free_list;
+		m_free_list = item;
+	}
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
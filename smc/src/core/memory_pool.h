@@ -0,0 +1,86 @@
+/***************************************************************************
+ * memory_pool.h
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SMC_MEMORY_POOL_H
+#define SMC_MEMORY_POOL_H
+
+#include "../core/global_basic.h"
+
+namespace SMC
+{
+
+/* *** *** *** *** *** cMemory_Pool *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Fixed size memory pool
+ * Memory is requested from the system in blocks of items and released items
+ * are reused before a new block is requested. Blocks are only freed with the pool.
+*/
+class cMemory_Pool
+{
+public:
+	cMemory_Pool( size_t item_size, unsigned int block_items = 256 );
+	~cMemory_Pool( void );
+
+	/* Return memory for one item
+	 * size : requested size which must not be larger than the item size
+	*/
+	void *Allocate( size_t size );
+	/* Return the item memory to the pool
+	 * size : size given to Allocate
+	*/
+	void Release( void *ptr, size_t size );
+
+	// Return the items currently in use
+	inline unsigned int Get_Used_Count( void ) const
+	{
+		return m_used_count;
+	}
+	// Return the total number of allocations
+	inline unsigned int Get_Allocation_Count( void ) const
+	{
+		return m_allocation_count;
+	}
+	// Return the number of blocks requested from the system
+	inline unsigned int Get_Block_Count( void ) const
+	{
+		return m_blocks.size();
+	}
+
+private:
+	// Request a new block from the system
+	void Add_Block( void );
+
+	// size of an item
+	size_t m_item_size;
+	// items per block
+	unsigned int m_block_items;
+
+	// memory blocks
+	typedef vector<char *> BlockList;
+	BlockList m_blocks;
+	// first free item
+	void *m_free_list;
+
+	// items in use
+	unsigned int m_used_count;
+	// total allocations
+	unsigned int m_allocation_count;
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
+
+#endif
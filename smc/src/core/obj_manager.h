@@ -39,15 +39,18 @@ public:
 	// Delete the object from given array number
 	virtual bool Delete( size_t array_num, bool delete_data = 1 )
 	{
-		// if in vector
-		if( array_num < objects.size() )
+		// not in vector
+		if( array_num >= objects.size() )
 		{
-			objects.erase( objects.begin() + array_num );
+			return 0;
 		}
 
+		T *obj = objects[array_num];
+		objects.erase( objects.begin() + array_num );
+
 		if( delete_data )
 		{
-			delete objects[array_num];
+			delete obj;
 		}
 
 		return 1;
@@ -0,0 +1,267 @@
+/***************************************************************************
+ * spatial_grid.h
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SMC_SPATIAL_GRID_H
+#define SMC_SPATIAL_GRID_H
+
+#include "../core/global_basic.h"
+#include "../core/math/rect.h"
+#include <boost/unordered_map.hpp>
+#include <algorithm>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** cSpatial_Grid *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Uniform grid index for rectangular objects
+ * Objects are registered with a bounding rect and can be looked up by area.
+ * Objects spanning more than max_cells cells are kept in a separate list
+ * which is returned by every query.
+*/
+template<class T> class cSpatial_Grid
+{
+public:
+	cSpatial_Grid( float cell_size = 256.0f, unsigned int max_cells = 64 )
+	: m_cell_size( cell_size ), m_max_cells( max_cells ), m_query_id( 0 ) {};
+	~cSpatial_Grid( void ) {};
+
+	// Remove all objects
+	void Clear( void )
+	{
+		m_cells.clear();
+		m_large_items.clear();
+		m_items.clear();
+		m_item_cells.clear();
+		m_item_map.clear();
+		m_query_marks.clear();
+		m_query_items.clear();
+		m_query_id = 0;
+	}
+
+	// Add the object with the given bounding rect
+	void Add( T obj, const GL_rect &rect )
+	{
+		const unsigned int item = m_items.size();
+		m_items.push_back( obj );
+		m_item_cells.push_back( cItem_Cells() );
+		m_item_map[obj] = item;
+		m_query_marks.push_back( 0 );
+
+		Insert_Item( item, rect );
+	}
+
+	/* Move an added object to the given bounding rect
+	 * it keeps its order and objects not added are ignored
+	*/
+	void Move( T obj, const GL_rect &rect )
+	{
+		typename ItemMap::const_iterator found = m_item_map.find( obj );
+
+		// not added
+		if( found == m_item_map.end() )
+		{
+			return;
+		}
+
+		Remove_Item( found->second );
+		Insert_Item( found->second, rect );
+	}
+
+	/* Add all objects from the cells touching the given rect
+	 * every object is only added once and in the order it was added to the grid
+	 * the result can contain objects not intersecting the rect and should be tested by the caller
+	*/
+	void Get_Objects( vector<T> &objects, const GL_rect &rect ) const
+	{
+		// new query mark
+		m_query_id++;
+
+		// overflow
+		if( !m_query_id )
+		{
+			std::fill( m_query_marks.begin(), m_query_marks.end(), 0 );
+			m_query_id = 1;
+		}
+
+		m_query_items = m_large_items;
+
+		int x1, y1, x2, y2;
+		Get_Cell_Range( rect, x1, y1, x2, y2 );
+
+		for( int y = y1; y <= y2; y++ )
+		{
+			for( int x = x1; x <= x2; x++ )
+			{
+				typename CellMap::const_iterator cell = m_cells.find( Get_Cell_Key( x, y ) );
+
+				// empty cell
+				if( cell == m_cells.end() )
+				{
+					continue;
+				}
+
+				for( ItemList::const_iterator itr = cell->second.begin(); itr != cell->second.end(); ++itr )
+				{
+					// already added
+					if( m_query_marks[*itr] == m_query_id )
+					{
+						continue;
+					}
+
+					m_query_marks[*itr] = m_query_id;
+					m_query_items.push_back( *itr );
+				}
+			}
+		}
+
+		// keep the insertion order
+		std::sort( m_query_items.begin(), m_query_items.end() );
+
+		for( ItemList::const_iterator itr = m_query_items.begin(); itr != m_query_items.end(); ++itr )
+		{
+			objects.push_back( m_items[*itr] );
+		}
+	}
+
+	// Return the object count
+	size_t size( void ) const
+	{
+		return m_items.size();
+	}
+
+	// Return true if no objects
+	bool empty( void ) const
+	{
+		return m_items.empty();
+	}
+
+private:
+	typedef vector<unsigned int> ItemList;
+	typedef boost::unordered_map<Uint64, ItemList> CellMap;
+	typedef boost::unordered_map<T, unsigned int> ItemMap;
+
+	// cells an item was inserted into
+	struct cItem_Cells
+	{
+		int m_x1, m_y1, m_x2, m_y2;
+		// if in the large items list instead
+		bool m_large;
+	};
+
+	// Insert the item into the cells touched by the rect
+	void Insert_Item( unsigned int item, const GL_rect &rect )
+	{
+		cItem_Cells &cells = m_item_cells[item];
+		Get_Cell_Range( rect, cells.m_x1, cells.m_y1, cells.m_x2, cells.m_y2 );
+
+		// too large for the grid
+		cells.m_large = static_cast<float>( cells.m_x2 - cells.m_x1 + 1 ) * static_cast<float>( cells.m_y2 - cells.m_y1 + 1 ) > static_cast<float>(m_max_cells);
+
+		if( cells.m_large )
+		{
+			m_large_items.push_back( item );
+			return;
+		}
+
+		for( int y = cells.m_y1; y <= cells.m_y2; y++ )
+		{
+			for( int x = cells.m_x1; x <= cells.m_x2; x++ )
+			{
+				m_cells[Get_Cell_Key( x, y )].push_back( item );
+			}
+		}
+	}
+
+	// Remove the item from its cells
+	void Remove_Item( unsigned int item )
+	{
+		const cItem_Cells &cells = m_item_cells[item];
+
+		if( cells.m_large )
+		{
+			m_large_items.erase( std::find( m_large_items.begin(), m_large_items.end(), item ) );
+			return;
+		}
+
+		for( int y = cells.m_y1; y <= cells.m_y2; y++ )
+		{
+			for( int x = cells.m_x1; x <= cells.m_x2; x++ )
+			{
+				typename CellMap::iterator cell = m_cells.find( Get_Cell_Key( x, y ) );
+				cell->second.erase( std::find( cell->second.begin(), cell->second.end(), item ) );
+
+				if( cell->second.empty() )
+				{
+					m_cells.erase( cell );
+				}
+			}
+		}
+	}
+
+	// Return the cells touched by the rect
+	inline void Get_Cell_Range( const GL_rect &rect, int &x1, int &y1, int &x2, int &y2 ) const
+	{
+		// rect edges are inclusive like in GL_rect::Intersects
+		x1 = static_cast<int>( floor( rect.m_x / m_cell_size ) );
+		y1 = static_cast<int>( floor( rect.m_y / m_cell_size ) );
+		x2 = static_cast<int>( floor( ( rect.m_x + rect.m_w ) / m_cell_size ) );
+		y2 = static_cast<int>( floor( ( rect.m_y + rect.m_h ) / m_cell_size ) );
+
+		if( x2 < x1 )
+		{
+			std::swap( x1, x2 );
+		}
+		if( y2 < y1 )
+		{
+			std::swap( y1, y2 );
+		}
+	}
+
+	// Return the map key for the cell
+	static inline Uint64 Get_Cell_Key( int x, int y )
+	{
+		return ( static_cast<Uint64>( static_cast<Uint32>(x) ) << 32 ) | static_cast<Uint32>(y);
+	}
+
+	// cell size in pixels
+	float m_cell_size;
+	// maximum cells an object can be added to
+	unsigned int m_max_cells;
+
+	// object item indexes per cell
+	CellMap m_cells;
+	// objects too large for the grid
+	ItemList m_large_items;
+	// all objects
+	vector<T> m_items;
+	// cells of every object
+	vector<cItem_Cells> m_item_cells;
+	// item index of every object
+	ItemMap m_item_map;
+
+	// last query an item was returned by
+	mutable vector<unsigned int> m_query_marks;
+	// current query
+	mutable unsigned int m_query_id;
+	// current query result buffer
+	mutable ItemList m_query_items;
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
+
+#endif
@@ -18,17 +18,79 @@
 #include "../level/level_player.h"
 #include "../input/mouse.h"
 #include "../overworld/world_player.h"
+#include "../objects/path.h"
+#include "../core/job_pool.h"
+#include <boost/bind.hpp>
 #include <algorithm>
+#include <limits>
+#include <cmath>
 
 namespace SMC
 {
 
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Return the next z position above the given one
+ * steps by the float precision at the given value and not by a fixed epsilon
+ * which can not collide with the given value and keeps dense levels within the z range of their type
+*/
+static inline float Get_Pos_Z_Above( const float pos_z )
+{
+	return pos_z + std::max( std::fabs( pos_z ) * std::numeric_limits<float>::epsilon(), std::numeric_limits<float>::min() );
+}
+
+// Return the next z position below the given one
+static inline float Get_Pos_Z_Below( const float pos_z )
+{
+	return pos_z - std::max( std::fabs( pos_z ) * std::numeric_limits<float>::epsilon(), std::numeric_limits<float>::min() );
+}
+
+/* Sort the objects or check if the sorted objects are still in order
+ * the z positions can be changed without the manager which makes a new sort needed
+*/
+template<class T> static void Sort_Objects( cSprite_List &sorted_objects, const cSprite_List &objects, bool rebuild, const T &sort )
+{
+	if( !rebuild )
+	{
+		for( unsigned int i = 1; i < sorted_objects.size(); i++ )
+		{
+			if( sort( sorted_objects[i], sorted_objects[i - 1] ) )
+			{
+				rebuild = 1;
+				break;
+			}
+		}
+
+		if( !rebuild )
+		{
+			return;
+		}
+	}
+
+	sorted_objects = objects;
+	// equal z positions keep the object array order
+	std::stable_sort( sorted_objects.begin(), sorted_objects.end(), sort );
+}
+
+// Insert the sprite into the sorted objects after all objects with the same z position
+template<class T> static void Insert_Sorted_Object( cSprite_List &sorted_objects, cSprite *sprite, const T &sort )
+{
+	sorted_objects.insert( std::upper_bound( sorted_objects.begin(), sorted_objects.end(), sprite, sort ), sprite );
+}
+
 /* *** *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
 cSprite_Manager :: cSprite_Manager( unsigned int reserve_items /* = 2000 */, unsigned int zpos_items /* = 100 */ )
 : cObject_Manager<cSprite>()
 {
 	objects.reserve( reserve_items );
+	m_modification_count = 0;
+	m_change_count = 0;
+	m_parallel_update = 1;
+	m_sorted_modification_count[0] = 0;
+	m_sorted_modification_count[1] = 0;
+	m_hot_modification_count = 0;
+	m_path_registry = new cPath_Registry();
 
 	m_z_pos_data.assign( zpos_items, 0.0f );
 	m_z_pos_data_editor.assign( zpos_items,0.0f );
@@ -37,6 +99,7 @@ cSprite_Manager :: cSprite_Manager( unsigned int reserve_items /* = 2000 */, uns
 cSprite_Manager :: ~cSprite_Manager( void )
 {
 	Delete_All();
+	delete m_path_registry;
 }
 
 void cSprite_Manager :: Add( cSprite *sprite )
@@ -47,8 +110,15 @@ void cSprite_Manager :: Add( cSprite *sprite )
 		return;
 	}
 
+	m_modification_count++;
 	Set_Pos_Z( sprite );
 
+	// paths can be linked by identifier
+	if( sprite->m_type == TYPE_PATH && !sprite->m_auto_destroy )
+	{
+		m_path_registry->Add_Path( static_cast<cPath *>(sprite) );
+	}
+
 	// Check if an destroyed object can be replaced
 	for( cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr )
 	{
@@ -60,6 +130,8 @@ void cSprite_Manager :: Add( cSprite *sprite )
 		{
 			// set new object
 			*itr = sprite;
+			Add_Sorted_Object( sprite, obj );
+			Add_Hot_Data( itr - objects.begin() );
 			// delete old
 			delete obj;
 
@@ -68,6 +140,8 @@ void cSprite_Manager :: Add( cSprite *sprite )
 	}
 
 	cObject_Manager<cSprite>::Add( sprite );
+	Add_Sorted_Object( sprite, NULL );
+	Add_Hot_Data( objects.size() - 1 );
 }
 
 cSprite *cSprite_Manager :: Copy( unsigned int identifier )
@@ -91,14 +165,14 @@ void cSprite_Manager :: Set_Pos_Z( cSprite *sprite )
 	// set new z position if unset
 	if( sprite->m_pos_z <= m_z_pos_data[sprite->m_type] )
 	{
-		sprite->m_pos_z = m_z_pos_data[sprite->m_type] + 0.000001f;
+		sprite->m_pos_z = Get_Pos_Z_Above( m_z_pos_data[sprite->m_type] );
 	}
 	// if editor z position is given
 	if( sprite->m_editor_pos_z > 0.0f )
 	{
 		if( sprite->m_editor_pos_z <= m_z_pos_data_editor[sprite->m_type] )
 		{
-			sprite->m_editor_pos_z = m_z_pos_data_editor[sprite->m_type] + 0.000001f;
+			sprite->m_editor_pos_z = Get_Pos_Z_Above( m_z_pos_data_editor[sprite->m_type] );
 		}
 	}
 
@@ -147,9 +221,11 @@ void cSprite_Manager :: Move_To_Front( cSprite *sprite )
 	objects.erase( itr );
 	objects.front() = sprite;
 	objects.insert( objects.begin() + 1, first );
+	Clear_Hot_Data();
 
 	// make it the first z position
-	sprite->m_pos_z = Get_First( sprite->m_type )->m_pos_z - 0.000001f;
+	sprite->m_pos_z = Get_Pos_Z_Below( Get_First( sprite->m_type )->m_pos_z );
+	Update_Sorted_Object( sprite );
 }
 
 void cSprite_Manager :: Move_To_Back( cSprite *sprite )
@@ -181,13 +257,37 @@ void cSprite_Manager :: Move_To_Back( cSprite *sprite )
 	objects.erase( itr );
 	objects.back() = sprite;
 	objects.insert( objects.end() - 1, last );
+	Clear_Hot_Data();
 
 	// make it the last z position
-	sprite->m_pos_z = Get_Last( sprite->m_type )->m_pos_z + 0.000001f;
+	sprite->m_pos_z = Get_Pos_Z_Above( Get_Last( sprite->m_type )->m_pos_z );
+	Update_Sorted_Object( sprite );
+
+	// new sprites are added above it
+	if( sprite->m_pos_z > m_z_pos_data[sprite->m_type] )
+	{
+		m_z_pos_data[sprite->m_type] = sprite->m_pos_z;
+	}
+}
+
+bool cSprite_Manager :: Delete( size_t array_num, bool delete_data /* = 1 */ )
+{
+	m_modification_count++;
+
+	return cObject_Manager<cSprite>::Delete( array_num, delete_data );
+}
+
+bool cSprite_Manager :: Delete( cSprite *obj, bool delete_data /* = 1 */ )
+{
+	m_modification_count++;
+
+	return cObject_Manager<cSprite>::Delete( obj, delete_data );
 }
 
 void cSprite_Manager :: Delete_All( bool delayed /* = 0 */ )
 {
+	m_modification_count++;
+
 	// delayed
 	if( delayed )
 	{
@@ -222,6 +322,11 @@ void cSprite_Manager :: Delete_All( bool delayed /* = 0 */ )
 		cObject_Manager<cSprite>::Delete_All();
 	}
 
+	// clear sorted objects
+	m_sorted_objects[0].clear();
+	m_sorted_objects[1].clear();
+	// clear collision data
+	Clear_Hot_Data();
 	// clear z position data
 	std::fill( m_z_pos_data.begin(), m_z_pos_data.end(), 0.0f );
 	std::fill( m_z_pos_data_editor.begin(), m_z_pos_data_editor.end(), 0.0f );
@@ -305,55 +410,151 @@ cSprite *cSprite_Manager :: Get_from_Position( int start_pos_x, int start_pos_y,
 
 void cSprite_Manager :: Get_Objects_sorted( cSprite_List &new_objects, bool editor_sort /* = 0 */, bool with_player /* = 0 */ ) const
 {
-	new_objects = objects;
+	Update_Sorted_Objects( editor_sort );
+	new_objects = m_sorted_objects[editor_sort];
 
 	if( with_player )
 	{
-		new_objects.push_back( pActive_Player );
+		// z position sort
+		if( !editor_sort )
+		{
+			// default
+			Insert_Sorted_Object( new_objects, pActive_Player, zpos_sort() );
+		}
+		else
+		{
+			// editor
+			Insert_Sorted_Object( new_objects, pActive_Player, editor_zpos_sort() );
+		}
 	}
+}
 
-	// z position sort
-	if( !editor_sort )
+void cSprite_Manager :: Get_Colliding_Objects( cSprite_List &col_objects, const GL_rect &rect, bool with_player /* = 0 */, const cSprite *exclude_sprite /* = NULL */ ) const
+{
+	if( !Is_Hot_Data_Valid() )
 	{
-		// default
-		std::sort( new_objects.begin(), new_objects.end(), zpos_sort() );
+		Update_Hot_Data();
 	}
-	else
+
+	// Check objects
+	for( unsigned int i = 0; i < objects.size(); i++ )
 	{
-		// editor
-		std::sort( new_objects.begin(), new_objects.end(), editor_zpos_sort() );
+		// if destroyed object
+		if( m_hot_flags[i] & HOT_DESTROYED )
+		{
+			continue;
+		}
+
+		// if rects don't touch
+		if( !rect.Intersects( m_hot_col_rects[i] ) )
+		{
+			continue;
+		}
+
+		// get object pointer
+		cSprite *obj = objects[i];
+
+		if( obj == exclude_sprite )
+		{
+			continue;
+		}
+
+		col_objects.push_back( obj );
+	}
+
+	if( with_player && pActive_Player != exclude_sprite )
+	{
+		if( rect.Intersects( pActive_Player->m_col_rect ) )
+		{
+			col_objects.push_back( pActive_Player );
+		}
 	}
 }
 
-void cSprite_Manager :: Get_Colliding_Objects( cSprite_List &col_objects, const GL_rect &rect, bool with_player /* = 0 */, const cSprite *exclude_sprite /* = NULL */ ) const
+void cSprite_Manager :: Get_Collidable_Objects( cSprite_List &col_objects, const GL_rect &rect, const cSprite *exclude_sprite /* = NULL */ ) const
 {
-	// Check objects
-	for( cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr )
+	if( !Is_Hot_Data_Valid() )
 	{
-		// get object pointer
-		cSprite *obj = (*itr);
+		Update_Hot_Data();
+	}
 
+	// Check objects
+	for( unsigned int i = 0; i < objects.size(); i++ )
+	{
 		// if destroyed object
-		if( obj == exclude_sprite || obj->m_auto_destroy )
+		if( m_hot_flags[i] & HOT_DESTROYED )
 		{
 			continue;
 		}
 
 		// if rects don't touch
-		if( !rect.Intersects( obj->m_col_rect ) )
+		if( !rect.Intersects( m_hot_col_rects[i] ) )
+		{
+			continue;
+		}
+
+		// if undefined, hud or animation
+		if( m_hot_sprite_arrays[i] == ARRAY_UNDEFINED || m_hot_sprite_arrays[i] == ARRAY_HUD || m_hot_sprite_arrays[i] == ARRAY_ANIM )
+		{
+			continue;
+		}
+
+		// get object pointer
+		cSprite *obj = objects[i];
+
+		if( obj == exclude_sprite )
 		{
 			continue;
 		}
 
 		col_objects.push_back( obj );
 	}
+}
 
-	if( with_player && pActive_Player != exclude_sprite )
+void cSprite_Manager :: Update_Items_Valid_Draw( void )
+{
+	if( !Is_Hot_Data_Valid() )
 	{
-		if( rect.Intersects( pActive_Player->m_col_rect ) )
+		Update_Hot_Data();
+	}
+
+	for( unsigned int i = 0; i < objects.size(); i++ )
+	{
+		// skip objects outside of the screen
+		if( !editor_enabled && !( m_hot_flags[i] & HOT_NO_CAMERA ) && m_hot_types[i] != TYPE_PARTICLE_EMITTER )
 		{
-			col_objects.push_back( pActive_Player );
+			const GL_rect &rect = m_hot_rects[i];
+
+			if( rect.m_x + rect.m_w < pActive_Camera->m_x || rect.m_x > pActive_Camera->m_x + game_res_w ||
+				rect.m_y + rect.m_h < pActive_Camera->m_y || rect.m_y > pActive_Camera->m_y + game_res_h )
+			{
+				objects[i]->m_valid_draw = 0;
+				continue;
+			}
 		}
+
+		objects[i]->Update_Valid_Draw();
+	}
+}
+
+void cSprite_Manager :: Update_Items_Parallel( void )
+{
+	if( m_parallel_update && pJob_Pool )
+	{
+		// a job for less objects is slower than the thread synchronization
+		pJob_Pool->Run( boost::bind( &cSprite_Manager::Update_Items_Parallel_Range, this, _1, _2 ), objects.size(), 256 );
+	}
+	else
+	{
+		Update_Items_Parallel_Range( 0, objects.size() );
+	}
+}
+
+void cSprite_Manager :: Update_Items_Parallel_Range( unsigned int start, unsigned int end )
+{
+	for( unsigned int i = start; i < end; i++ )
+	{
+		objects[i]->Update_Parallel();
 	}
 }
 
@@ -382,6 +583,181 @@ void cSprite_Manager :: Handle_Collision_Items( void )
 	}
 }
 
+void cSprite_Manager :: Update_Sorted_Objects( bool editor_sort ) const
+{
+	cSprite_List &sorted_objects = m_sorted_objects[editor_sort];
+	// object list changed since the last sort
+	bool rebuild = m_sorted_modification_count[editor_sort] != m_modification_count || sorted_objects.size() != objects.size();
+
+	// z position sort
+	if( !editor_sort )
+	{
+		// default
+		Sort_Objects( sorted_objects, objects, rebuild, zpos_sort() );
+	}
+	else
+	{
+		// editor
+		Sort_Objects( sorted_objects, objects, rebuild, editor_zpos_sort() );
+	}
+
+	m_sorted_modification_count[editor_sort] = m_modification_count;
+}
+
+void cSprite_Manager :: Add_Sorted_Object( cSprite *sprite, const cSprite *replaced_sprite )
+{
+	for( unsigned int i = 0; i < 2; i++ )
+	{
+		// outdated before this addition and will be rebuilt when needed
+		if( m_sorted_modification_count[i] + 1 != m_modification_count )
+		{
+			continue;
+		}
+
+		cSprite_List &sorted_objects = m_sorted_objects[i];
+
+		if( replaced_sprite )
+		{
+			cSprite_List::iterator itr = std::find( sorted_objects.begin(), sorted_objects.end(), replaced_sprite );
+
+			// not available
+			if( itr == sorted_objects.end() )
+			{
+				continue;
+			}
+
+			sorted_objects.erase( itr );
+		}
+
+		// z position sort
+		if( !i )
+		{
+			// default
+			Insert_Sorted_Object( sorted_objects, sprite, zpos_sort() );
+		}
+		else
+		{
+			// editor
+			Insert_Sorted_Object( sorted_objects, sprite, editor_zpos_sort() );
+		}
+
+		m_sorted_modification_count[i] = m_modification_count;
+	}
+}
+
+void cSprite_Manager :: Update_Sorted_Object( cSprite *sprite )
+{
+	for( unsigned int i = 0; i < 2; i++ )
+	{
+		// outdated
+		if( m_sorted_modification_count[i] != m_modification_count )
+		{
+			continue;
+		}
+
+		cSprite_List &sorted_objects = m_sorted_objects[i];
+		cSprite_List::iterator itr = std::find( sorted_objects.begin(), sorted_objects.end(), sprite );
+
+		// not available
+		if( itr == sorted_objects.end() )
+		{
+			continue;
+		}
+
+		sorted_objects.erase( itr );
+
+		// z position sort
+		if( !i )
+		{
+			// default
+			Insert_Sorted_Object( sorted_objects, sprite, zpos_sort() );
+		}
+		else
+		{
+			// editor
+			Insert_Sorted_Object( sorted_objects, sprite, editor_zpos_sort() );
+		}
+	}
+}
+
+void cSprite_Manager :: Update_Hot_Data( const cSprite *sprite )
+{
+	m_change_count++;
+
+	// not in the up to date collision data
+	if( !Is_Hot_Data_Valid() || sprite->m_hot_index >= objects.size() || objects[sprite->m_hot_index] != sprite )
+	{
+		return;
+	}
+
+	Set_Hot_Data( sprite->m_hot_index );
+}
+
+void cSprite_Manager :: Update_Hot_Data( void ) const
+{
+	m_hot_col_rects.resize( objects.size() );
+	m_hot_rects.resize( objects.size() );
+	m_hot_flags.resize( objects.size() );
+	m_hot_sprite_arrays.resize( objects.size() );
+	m_hot_types.resize( objects.size() );
+
+	for( unsigned int i = 0; i < objects.size(); i++ )
+	{
+		Set_Hot_Data( i );
+	}
+
+	m_hot_modification_count = m_modification_count;
+}
+
+void cSprite_Manager :: Add_Hot_Data( unsigned int index )
+{
+	// outdated before this addition and will be rebuilt when needed
+	if( m_hot_modification_count + 1 != m_modification_count )
+	{
+		return;
+	}
+
+	// appended
+	if( index == m_hot_col_rects.size() )
+	{
+		m_hot_col_rects.push_back( GL_rect() );
+		m_hot_rects.push_back( GL_rect() );
+		m_hot_flags.push_back( 0 );
+		m_hot_sprite_arrays.push_back( ARRAY_UNDEFINED );
+		m_hot_types.push_back( TYPE_UNDEFINED );
+	}
+
+	m_hot_modification_count = m_modification_count;
+
+	if( !Is_Hot_Data_Valid() )
+	{
+		return;
+	}
+
+	Set_Hot_Data( index );
+}
+
+void cSprite_Manager :: Set_Hot_Data( unsigned int index ) const
+{
+	cSprite *obj = objects[index];
+
+	obj->m_hot_index = index;
+	m_hot_col_rects[index] = obj->m_col_rect;
+	m_hot_rects[index] = obj->m_rect;
+	m_hot_flags[index] = ( obj->m_auto_destroy ? HOT_DESTROYED : 0 ) | ( obj->m_no_camera ? HOT_NO_CAMERA : 0 );
+	m_hot_sprite_arrays[index] = obj->m_sprite_array;
+	m_hot_types[index] = obj->m_type;
+}
+
+void cSprite_Manager :: Clear_Hot_Data( void )
+{
+	m_hot_col_rects.clear();
+	m_hot_rects.clear();
+	m_hot_flags.clear();
+	m_hot_sprite_arrays.clear();
+	m_hot_types.clear();
+}
+
 unsigned int cSprite_Manager :: Get_Size_Array( const ArrayType sprite_array )
 {
 	unsigned int count = 0;
@@ -23,6 +23,9 @@
 namespace SMC
 {
 
+// forward declaration
+class cPath_Registry;
+
 /* *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** *** */
 
 class cSprite_Manager : public cObject_Manager<cSprite>
@@ -35,6 +38,11 @@ public:
 	 */
 	virtual void Add( cSprite *sprite );
 
+	// Delete the object from the given array number
+	virtual bool Delete( size_t array_num, bool delete_data = 1 );
+	// Delete the given object
+	virtual bool Delete( cSprite *obj, bool delete_data = 1 );
+
 	// Return a sprite copy
 	cSprite *Copy( unsigned int identifier );
 
@@ -78,22 +86,32 @@ public:
 	 * exclude_sprite : exclude the given sprite from check
 	*/
 	void Get_Colliding_Objects( cSprite_List &col_objects, const GL_rect &rect, bool with_player = 0, const cSprite *exclude_sprite = NULL ) const;
+	/* Get objects colliding with the given rectangle which can be part of a collision
+	 * skips undefined, hud and animation objects
+	 * exclude_sprite : exclude the given sprite from check
+	*/
+	void Get_Collidable_Objects( cSprite_List &col_objects, const GL_rect &rect, const cSprite *exclude_sprite = NULL ) const;
 
-	// Update items drawing validation
-	inline void Update_Items_Valid_Draw( void )
-	{
-		for( cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr )
-		{
-			(*itr)->Update_Valid_Draw();
-		}
-	}
+	/* Update items drawing validation
+	 * objects outside of the screen are rejected with the rect copy in the collision data
+	*/
+	void Update_Items_Valid_Draw( void );
+	/* Update_Parallel items
+	 * split between the job pool threads if parallel update is enabled
+	*/
+	void Update_Items_Parallel( void );
 	// Update items
 	inline void Update_Items( void )
 	{
+		Update_Items_Parallel();
+
 		for( cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr )
 		{
 			(*itr)->Update();
 		}
+
+		// objects can change the collision data without the setters
+		Update_Hot_Data();
 	}
 	// Update_Late items
 	inline void Update_Items_Late( void )
@@ -116,6 +134,14 @@ public:
 	void Handle_Collision_Items( void );
 
 
+	/* Update the collision data of the given sprite
+	 * does nothing if the sprite is not in the collision data
+	 * always increases the object change count
+	*/
+	void Update_Hot_Data( const cSprite *sprite );
+	// Rebuild the collision data of all objects
+	void Update_Hot_Data( void ) const;
+
 	/* Return the current size
 	 * of the specified sprite array
 	 */
@@ -127,6 +153,23 @@ public:
 		return Get_Pointer( identifier );
 	}
 
+	/* Return the object list modification count
+	 * increases every time objects are added, replaced or deleted
+	 * used to validate pointers cached outside of the manager
+	*/
+	inline unsigned int Get_Modification_Count( void ) const
+	{
+		return m_modification_count;
+	}
+	/* Return the object change count
+	 * increases every time an object position, size or collision state is set
+	 * used to validate object rects cached outside of the manager
+	*/
+	inline unsigned int Get_Change_Count( void ) const
+	{
+		return m_change_count;
+	}
+
 	typedef vector<float> ZposList;
 	// biggest type z position
 	ZposList m_z_pos_data;
@@ -142,35 +185,78 @@ public:
 		}
 	};
 
+	// object list modification count
+	unsigned int m_modification_count;
+	// object change count
+	unsigned int m_change_count;
+	// if Update_Parallel is split between the job pool threads
+	bool m_parallel_update;
+
+	// identifier index of the paths and the path states linking to them
+	cPath_Registry *m_path_registry;
+
 	// Editor Z position sort
 	struct editor_zpos_sort
 	{
+		// the editor z position replaces the z position if available
+		static inline float Get_Pos_Z( const cSprite *obj )
+		{
+			return obj->m_editor_pos_z ? obj->m_editor_pos_z : obj->m_pos_z;
+		}
+
 		bool operator()( const cSprite *a, const cSprite *b ) const
 		{
-			// check if the editor zpos is available
-			if( !a->m_editor_pos_z )
-			{
-				if( !b->m_editor_pos_z )
-				{
-					return a->m_pos_z < b->m_pos_z;
-				}
-
-				return a->m_pos_z < b->m_editor_pos_z;
-			}
-			if( !b->m_editor_pos_z )
-			{
-				if( !a->m_editor_pos_z )
-				{
-					return a->m_pos_z < b->m_pos_z;
-				}
-
-				return a->m_editor_pos_z < b->m_pos_z;
-			}
-
-			// both objects have an editor z pos
-			return a->m_editor_pos_z < b->m_editor_pos_z;
+			return Get_Pos_Z( a ) < Get_Pos_Z( b );
 		}
 	};
+
+private:
+	// Update_Parallel the objects from start to end which is not included
+	void Update_Items_Parallel_Range( unsigned int start, unsigned int end );
+	// Rebuild the sorted objects if outdated or if z positions changed outside of the manager
+	void Update_Sorted_Objects( bool editor_sort ) const;
+	/* Insert the added sprite into the up to date sorted objects
+	 * replaced_sprite : the destroyed sprite replaced by the added sprite if any
+	*/
+	void Add_Sorted_Object( cSprite *sprite, const cSprite *replaced_sprite );
+	// Move the sprite to its new z position in the up to date sorted objects
+	void Update_Sorted_Object( cSprite *sprite );
+	// Return true if the collision data matches the objects
+	inline bool Is_Hot_Data_Valid( void ) const
+	{
+		return m_hot_modification_count == m_modification_count && m_hot_col_rects.size() == objects.size();
+	}
+	// Add the collision data of the added object at the index to the up to date collision data
+	void Add_Hot_Data( unsigned int index );
+	// Copy the collision data of the object at the index
+	void Set_Hot_Data( unsigned int index ) const;
+	// Clear the collision data if the object order changed
+	void Clear_Hot_Data( void );
+
+	/* objects sorted by z position and by editor z position
+	 * updated on add and z position changes and only rebuilt if the object list changed otherwise
+	*/
+	mutable cSprite_List m_sorted_objects[2];
+	// object list modification count the sorted objects are valid for
+	mutable unsigned int m_sorted_modification_count[2];
+
+	/* collision data of the objects in the same order as the objects
+	 * the collision and visibility checks read these arrays instead of every sprite
+	 * updated by the sprite setters and rebuilt if the object order changed
+	*/
+	mutable vector<GL_rect> m_hot_col_rects;
+	mutable vector<GL_rect> m_hot_rects;
+	// hot data flags
+	enum
+	{
+		HOT_DESTROYED = 1,
+		HOT_NO_CAMERA = 2
+	};
+	mutable vector<Uint8> m_hot_flags;
+	mutable vector<ArrayType> m_hot_sprite_arrays;
+	mutable vector<SpriteType> m_hot_types;
+	// object list modification count the collision data is valid for
+	mutable unsigned int m_hot_modification_count;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -56,6 +56,7 @@ cTurtleBoss :: ~cTurtleBoss( void )
 void cTurtleBoss :: Init( void )
 {
 	m_type = TYPE_TURTLE_BOSS;
+	m_update_animation_parallel = 1;
 	m_pos_z = 0.092f;
 	m_gravity_max = 19.0f;
 
@@ -668,7 +669,7 @@ bool cTurtleBoss :: Hit_Enemy( cEnemy *enemy ) const
 	}
 
 	// hit enemy
-	pAudio->Play_Sound( enemy->m_kill_sound );
+	pAudio->Play_Sound_At( enemy->m_kill_sound, enemy->m_col_rect.m_x + enemy->m_col_rect.m_w * 0.5f, enemy->m_col_rect.m_y + enemy->m_col_rect.m_h * 0.5f );
 	pHud_Points->Add_Points( enemy->m_kill_points, m_pos_x + m_image->m_w / 3, m_pos_y - 5.0f, "", static_cast<Uint8>(255), 1 );
 	enemy->DownGrade( 1 );
 	pLevel_Player->Add_Kill_Multiplier();
@@ -715,17 +716,11 @@ void cTurtleBoss :: Throw_Fireballs( unsigned int amount /* = 6 */ )
 void cTurtleBoss :: Generate_Stars( unsigned int amount /* = 1 */, float particle_scale /* = 0.4f */ ) const
 {
 	// animation
-	cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
+	cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_TURTLE_BOSS_STARS, m_sprite_manager );
 	anim->Set_Pos( m_pos_x + ( m_col_rect.m_w * 0.5f ), m_pos_y + ( m_col_rect.m_h * 0.5f ) );
-	anim->Set_Image( pVideo->Get_Surface( "animation/particles/star.png" ) );
 	anim->Set_Quota( amount );
 	anim->Set_Pos_Z( m_pos_z + 0.000001f );
-	anim->Set_Const_Rotation_Z( -6.0f, 12.0f );
-	anim->Set_Time_to_Live( 1.0f );
-	anim->Set_Speed( 1.0f, 4.0f );
 	anim->Set_Scale( particle_scale, 0.3f );
-	anim->Set_Color( orange, Color( static_cast<Uint8>(6), 60, 20, 0 ) );
-	anim->Set_Blending( BLEND_ADD );
 	anim->Emit();
 	pActive_Animation_Manager->Add( anim );
 }
@@ -925,9 +920,7 @@ void cTurtleBoss :: Handle_Collision_Player( cObjectCollision *collision )
 		}
 
 		// animation
-		cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-		anim->Set_Pos( m_pos_x + ( m_col_rect.m_w / 2 ), m_pos_y + ( m_col_rect.m_h / 2 ) );
-		Generate_Hit_Animation( anim );
+		cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 
 		anim->Set_Speed( 4, 0.8f );
 		anim->Set_Scale( 0.9f );
@@ -967,15 +960,9 @@ void cTurtleBoss :: Handle_Collision_Player( cObjectCollision *collision )
 			pAudio->Play_Sound( "enemy/turtle/shell/hit.ogg" );
 			DownGrade();
 
-			cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-			anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
-			anim->Set_Quota( 4 );
+			cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_SHELL_HIT, m_sprite_manager );
 			anim->Set_Pos_Z( m_pos_z + 0.0001f );
-			anim->Set_Time_to_Live( 0.3f );
-			anim->Set_Speed( 4, 0.5f );
 			anim->Set_Scale( 0.8f );
-			anim->Set_Fading_Size( 1 );
-			anim->Set_Color( Color( static_cast<Uint8>(254), 200, 100 ) );
 
 			if( collision->m_direction == DIR_RIGHT )
 			{
@@ -1088,26 +1075,20 @@ void cTurtleBoss :: Handle_Collision_Massive( cObjectCollision *collision )
 			cSprite *col_object = m_sprite_manager->Get_Pointer( collision->m_number );
 
 			// animation
-			cParticle_Emitter *anim = NULL;
+			cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_SHELL_WALL_SMOKE, m_sprite_manager );
 			if( collision->m_direction == DIR_RIGHT )
 			{
-				anim = new cParticle_Emitter( m_sprite_manager );
 				anim->Set_Pos( col_object->m_pos_x + col_object->m_col_pos.m_x + 4, m_pos_y + ( m_col_rect.m_h / 1.35f ), 1 );
 				anim->Set_Direction_Range( 140.0f, 100.0f );
 			}
 			else
 			{
-				anim = new cParticle_Emitter( m_sprite_manager );
 				anim->Set_Pos( col_object->m_pos_x + col_object->m_col_pos.m_x + col_object->m_col_rect.m_w - 4, m_pos_y + ( m_col_rect.m_h / 1.35f ), 1 );
 				anim->Set_Direction_Range( 320.0f, 100.0f );
 			}
 
-			anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke.png" ) );
-			anim->Set_Quota( 5 );
 			anim->Set_Pos_Z( col_object->m_pos_z - 0.0001f, 0.0002f );
 			anim->Set_Time_to_Live( 0.3f );
-			anim->Set_Speed( 1.0f, 1.0f );
-			anim->Set_Scale( 0.5f, 0.4f );
 			anim->Emit();
 			pActive_Animation_Manager->Add( anim );
 		}
@@ -15,6 +15,7 @@
 
 #include "../enemies/eato.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../video/animation.h"
 #include "../level/level_player.h"
 #include "../video/gl_surface.h"
@@ -53,6 +54,7 @@ cEato :: ~cEato( void )
 void cEato :: Init( void )
 {
 	m_type = TYPE_EATO;
+	m_update_animation_parallel = 1;
 	m_camera_range = 1000;
 	m_pos_z = 0.087f;
 	m_can_be_on_ground = 0;
@@ -125,8 +127,11 @@ void cEato :: Set_Image_Dir( std::string dir )
 		dir.insert( dir.length(), "/" );
 	}
 
+	static const char *const frames[] = { "1.png", "2.png", "3.png", "2.png", NULL };
+	const cImage_Set *image_set = pImage_Set_Manager->Get( m_type, dir, frames );
+
 	// if not image directory
-	if( !File_Exists( DATA_DIR "/" GAME_PIXMAPS_DIR "/" + dir + "1.png" ) && !File_Exists( DATA_DIR "/" GAME_PIXMAPS_DIR "/" + dir + "1.settings" ) )
+	if( !image_set->m_valid )
 	{
 		printf( "Warning : Eato image dir does not exist %s\n", dir.c_str() );
 		return;
@@ -137,10 +142,7 @@ void cEato :: Set_Image_Dir( std::string dir )
 	// clear images
 	Clear_Images();
 	// set images
-	Add_Image( pVideo->Get_Surface( m_img_dir + "1.png" ) );
-	Add_Image( pVideo->Get_Surface( m_img_dir + "2.png" ) );
-	Add_Image( pVideo->Get_Surface( m_img_dir + "3.png" ) );
-	Add_Image( pVideo->Get_Surface( m_img_dir + "2.png" ) );
+	Add_Images( image_set );
 	// set start image
 	Set_Image_Num( 0, 1 );
 
@@ -212,8 +214,7 @@ void cEato :: DownGrade( bool force /* = 0 */ )
 	if( !force )
 	{
 		// animation
-		cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-		Generate_Hit_Animation( anim );
+		cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 
 		anim->Set_Scale( 0.8f );
 		anim->Set_Direction_Range( 0.0f, 360.0f );
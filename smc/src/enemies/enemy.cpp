@@ -48,6 +48,7 @@ cEnemy :: cEnemy( cSprite_Manager *sprite_manager )
 
 	m_fire_resistant = 0;
 	m_can_be_hit_from_shell = 1;
+	m_update_animation_parallel = 0;
 }
 
 cEnemy :: ~cEnemy( void )
@@ -156,6 +157,19 @@ void cEnemy :: Set_Dead( bool enable /* = 1 */ )
 	Update_Valid_Update();
 }
 
+void cEnemy :: Update_Parallel( void )
+{
+	// discard the animation time update if Update returned before using it
+	m_anim_time_updated = 0;
+
+	if( !m_update_animation_parallel || !m_valid_update || !Is_In_Range() )
+	{
+		return;
+	}
+
+	Update_Animation_Time();
+}
+
 void cEnemy :: Update( void )
 {
 	cMovingSprite::Update();
@@ -259,28 +273,18 @@ void cEnemy :: Update_Gravity( void )
 	}
 }
 
-void cEnemy :: Generate_Hit_Animation( cParticle_Emitter *anim /* = NULL */ ) const
+cParticle_Emitter *cEnemy :: Generate_Hit_Animation( bool add /* = 1 */ ) const
 {
-	bool create_anim = 0;
-
-	if( !anim )
-	{
-		create_anim = 1;
-		// create animation
-		anim = new cParticle_Emitter( m_sprite_manager );
-	}
-
+	// create animation
+	cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_ENEMY_HIT, m_sprite_manager );
 	anim->Set_Emitter_Rect( m_col_rect.m_x, m_pos_y + ( m_col_rect.m_h / 3 ), m_col_rect.m_w );
-	anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
-	anim->Set_Quota( 4 );
 	anim->Set_Pos_Z( m_pos_z - 0.000001f );
-	anim->Set_Time_to_Live( 0.3f );
-	Color col_rand = Color( static_cast<Uint8>( rand() % 5 ), rand() % 5, rand() % 100, 0 );
+	Color col_rand = Color( static_cast<Uint8>( Get_Random_Int( 5, RANDOM_STREAM_PARTICLE ) ), Get_Random_Int( 5, RANDOM_STREAM_PARTICLE ), Get_Random_Int( 100, RANDOM_STREAM_PARTICLE ), 0 );
 	// not bright enough
 	/*if( col_rand.red + col_rand.green + col_rand.blue < 250 )
 	{
 		// boost a random color
-		unsigned int rand_color = ( rand() % 3 );
+		unsigned int rand_color = Get_Random_Int( 3, RANDOM_STREAM_PARTICLE );
 
 		// yellow
 		if( rand_color == 0 )
@@ -299,19 +303,15 @@ void cEnemy :: Generate_Hit_Animation( cParticle_Emitter *anim /* = NULL */ ) co
 			col_rand.blue = 175;
 		}
 	}*/
-	anim->Set_Color( Color( static_cast<Uint8>(250), 250, 150, 255 ), col_rand );
-	anim->Set_Speed( 0.5f, 2.6f );
-	anim->Set_Scale( 0.2f, 0.6f );
-	anim->Set_Direction_Range( 220, 100 );
-	anim->Set_Fading_Alpha( 1 );
-	//anim->Set_Fading_Size( 1 );
-	anim->Set_Blending( BLEND_ADD );
+	anim->Set_Color( anim->m_color, col_rand );
 	
-	if( create_anim )
+	if( add )
 	{
 		anim->Emit();
 		pActive_Animation_Manager->Add( anim );
 	}
+
+	return anim;
 }
 
 void cEnemy :: Handle_Collision( cObjectCollision *collision )
@@ -43,6 +43,8 @@ public:
 
 	// dying animation update
 	virtual void Update_Dying( void ) {};
+	// update the animation time if the animation is the first update
+	virtual void Update_Parallel( void );
 	// handle basic enemy updates
 	virtual void Update( void );
 	/* late update
@@ -54,8 +56,11 @@ public:
 	// update gravity velocity
 	virtual void Update_Gravity( void );
 	
-	// Generates the default Hit Animation Particles
-	void Generate_Hit_Animation( cParticle_Emitter *anim = NULL ) const;
+	/* Generates the default Hit Animation Particles and returns the emitter
+	 * if add is set it is emitted and added to the animation manager which owns it
+	 * if add is not set it has to be changed, emitted and added by the caller
+	*/
+	cParticle_Emitter *Generate_Hit_Animation( bool add = 1 ) const;
 
 	// default collision handler
 	virtual void Handle_Collision( cObjectCollision *collision );
@@ -84,6 +89,10 @@ public:
 	//bool m_can_be_hit_from_top;
 	// if this can be hit from a shell
 	bool m_can_be_hit_from_shell;
+	/* if the animation time is updated in Update_Parallel
+	 * only set if Update calls Update_Animation first after the update validation and range check
+	*/
+	bool m_update_animation_parallel;
 	// if this moves into an abyss
 	//bool m_moves_into_abyss;
 };
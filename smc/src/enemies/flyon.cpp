@@ -15,6 +15,7 @@
 
 #include "../enemies/flyon.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../level/level_player.h"
 #include "../video/animation.h"
 #include "../user/savegame.h"
@@ -56,6 +57,7 @@ cFlyon :: ~cFlyon( void )
 void cFlyon :: Init( void  )
 {
 	m_type = TYPE_FLYON;
+	m_update_animation_parallel = 1;
 	m_pos_z = 0.06f;
 	Set_Rotation_Affects_Rect( 1 );
 	m_editor_pos_z = 0.089f;
@@ -167,8 +169,11 @@ void cFlyon :: Set_Image_Dir( std::string dir )
 		dir.insert( dir.length(), "/" );
 	}
 
+	static const char *const frames[] = { "closed_1.png", "closed_2.png", "open_1.png", "open_2.png", NULL };
+	const cImage_Set *image_set = pImage_Set_Manager->Get( m_type, dir, frames );
+
 	// if not image directory
-	if( !File_Exists( DATA_DIR "/" GAME_PIXMAPS_DIR "/" + dir + "closed_1.png" ) && !File_Exists( DATA_DIR "/" GAME_PIXMAPS_DIR "/" + dir + "closed_1.settings" ) )
+	if( !image_set->m_valid )
 	{
 		printf( "Warning : Flyon image dir does not exist %s\n", dir.c_str() );
 		return;
@@ -179,10 +184,7 @@ void cFlyon :: Set_Image_Dir( std::string dir )
 	// clear images
 	Clear_Images();
 	// set images
-	Add_Image( pVideo->Get_Surface( m_img_dir + "closed_1.png" ) );
-	Add_Image( pVideo->Get_Surface( m_img_dir + "closed_2.png" ) );
-	Add_Image( pVideo->Get_Surface( m_img_dir + "open_1.png" ) );
-	Add_Image( pVideo->Get_Surface( m_img_dir + "open_2.png" ) );
+	Add_Images( image_set );
 	// set start image
 	Set_Image_Num( 0, 1 );
 
@@ -268,8 +270,7 @@ void cFlyon :: DownGrade( bool force /* = 0 */ )
 	if( !force )
 	{
 		// animation
-		cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-		Generate_Hit_Animation( anim );
+		cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 
 		anim->Set_Speed( 5.0f, 0.6f );
 		anim->Set_Scale( 0.8f );
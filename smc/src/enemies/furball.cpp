@@ -15,6 +15,7 @@
 
 #include "../enemies/furball.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../level/level_player.h"
 #include "../gui/hud.h"
 #include "../core/i18n.h"
@@ -54,6 +55,7 @@ cFurball :: ~cFurball( void )
 void cFurball :: Init( void )
 {
 	m_type = TYPE_FURBALL;
+	m_update_animation_parallel = 1;
 	m_pos_z = 0.09f;
 	m_gravity_max = 19.0f;
 
@@ -214,16 +216,8 @@ void cFurball :: Set_Color( const DefaultColor &col )
 
 	Update_Velocity_Max();
 
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_1.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_2.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_3.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_4.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_5.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_6.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_7.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/walk_8.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/turn.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/furball/" + filename_dir + "/dead.png" ) );
+	static const char *const frames[] = { "/walk_1.png", "/walk_2.png", "/walk_3.png", "/walk_4.png", "/walk_5.png", "/walk_6.png", "/walk_7.png", "/walk_8.png", "/turn.png", "/dead.png", NULL };
+	Add_Images( pImage_Set_Manager->Get( m_type, "enemy/furball/" + filename_dir, frames ) );
 
 	// boss has hit image
 	if( m_type == TYPE_FURBALL_BOSS )
@@ -558,13 +552,10 @@ void cFurball :: Update( void )
 		// create particles
 		if( m_running_particle_counter >= 1.0f )
 		{
-			cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
+			cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_RUNNING_SMOKE, m_sprite_manager );
 			anim->Set_Emitter_Rect( m_col_rect.m_x, m_col_rect.m_y + m_col_rect.m_h - 2.0f, m_col_rect.m_w );
 			anim->Set_Quota( static_cast<int>(m_running_particle_counter) );
 			anim->Set_Pos_Z( m_pos_z - 0.000001f );
-			anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke_black.png" ) );
-			anim->Set_Time_to_Live( 0.6f );
-			anim->Set_Scale( 0.2f );
 
 			float vel;
 
@@ -628,16 +619,11 @@ void cFurball :: Update( void )
 void cFurball :: Generate_Smoke( unsigned int amount /* = 1 */, float particle_scale /* = 0.4f */ ) const
 {
 	// animation
-	cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
+	cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_FURBALL_SMOKE, m_sprite_manager );
 	anim->Set_Pos( m_pos_x + ( m_col_rect.m_w * 0.5f ), m_pos_y + ( m_col_rect.m_h * 0.5f ), 1 );
-	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke_grey_big.png" ) );
 	anim->Set_Quota( amount );
 	anim->Set_Pos_Z( m_pos_z + 0.000001f );
-	anim->Set_Const_Rotation_Z( -6.0f, 12.0f );
-	anim->Set_Time_to_Live( 1.5f );
-	anim->Set_Speed( 0.4f, 0.9f );
 	anim->Set_Scale( particle_scale, 0.2f );
-	anim->Set_Color( black, Color( static_cast<Uint8>(87), 60, 40, 0 ) );
 	anim->Emit();
 	pActive_Animation_Manager->Add( anim );
 }
@@ -15,6 +15,7 @@
 
 #include "../enemies/gee.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../video/animation.h"
 #include "../level/level_player.h"
 #include "../gui/hud.h"
@@ -53,6 +54,7 @@ cGee :: ~cGee( void )
 void cGee :: Init( void  )
 {
 	m_type = TYPE_GEE;
+	m_update_animation_parallel = 1;
 	m_camera_range = 1000;
 	m_pos_z = 0.088f;
 	m_can_be_on_ground = 0;
@@ -246,16 +248,8 @@ void cGee :: Set_Color( DefaultColor col )
 
 	Create_Name();
 
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/1.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/2.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/3.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/4.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/5.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/6.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/7.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/8.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/9.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/gee/" + filename_dir + "/10.png" ) );
+	static const char *const frames[] = { "/1.png", "/2.png", "/3.png", "/4.png", "/5.png", "/6.png", "/7.png", "/8.png", "/9.png", "/10.png", NULL };
+	Add_Images( pImage_Set_Manager->Get( m_type, "enemy/gee/" + filename_dir, frames ) );
 
 	Set_Image_Num( 0, 1 );
 
@@ -341,7 +335,7 @@ void cGee :: Set_Moving_State( Moving_state new_state )
 		if( m_start_direction == DIR_HORIZONTAL )
 		{
 			// randomize direction
-			if( rand() % 2 != 1 )
+			if( Get_Random_Int( 2 ) != 1 )
 			{
 				m_direction = DIR_RIGHT;
 				m_velx = m_speed_fly;
@@ -359,7 +353,7 @@ void cGee :: Set_Moving_State( Moving_state new_state )
 			m_velx = 0.0f;
 			
 			// randomize direction
-			if( rand() % 2 != 1 )
+			if( Get_Random_Int( 2 ) != 1 )
 			{
 				m_direction = DIR_DOWN;
 				m_vely = m_speed_fly;
@@ -485,8 +479,7 @@ void cGee :: Stop( void )
 
 void cGee :: Generate_Particles( unsigned int amount /* = 4 */ ) const
 {
-	cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-	anim->Set_Image( pVideo->Get_Surface( "animation/particles/cloud.png" ) );
+	cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_GEE_CLOUD, m_sprite_manager );
 	anim->Set_Pos_Z( m_pos_z - 0.00001f );
 	anim->Set_Emitter_Rect( m_col_rect.m_x + ( m_col_rect.m_w * 0.3f ), m_col_rect.m_y + ( m_col_rect.m_h * 0.2f ), m_col_rect.m_w * 0.4f, m_col_rect.m_h * 0.3f );
 	anim->Set_Quota( amount );
@@ -510,8 +503,6 @@ void cGee :: Generate_Particles( unsigned int amount /* = 4 */ ) const
 		anim->Set_Speed( 0.1f, 0.6f );
 	}
 
-	anim->Set_Scale( 0.5f, 0.3f );
-
 	// color
 	if( m_color_type == COL_YELLOW )
 	{
@@ -525,9 +516,7 @@ void cGee :: Generate_Particles( unsigned int amount /* = 4 */ ) const
 	{
 		anim->Set_Color( lightgreen );
 	}
-	anim->Set_Time_to_Live( 2.0f );
-	anim->Set_Fading_Alpha( 1 );
-	anim->Set_Blending( BLEND_ADD );
+
 	anim->Emit();
 	pActive_Animation_Manager->Add( anim );
 }
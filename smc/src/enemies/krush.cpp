@@ -15,6 +15,7 @@
 
 #include "../enemies/krush.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../video/animation.h"
 #include "../gui/hud.h"
 #include "../level/level_player.h"
@@ -57,14 +58,8 @@ void cKrush :: Init( void  )
 	m_pos_z = 0.093f;
 	m_gravity_max = 27.0f;
 
-	Add_Image( pVideo->Get_Surface( "enemy/krush/big_1.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/krush/big_2.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/krush/big_3.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/krush/big_4.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/krush/small_1.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/krush/small_2.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/krush/small_3.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/krush/small_4.png" ) );
+	static const char *const frames[] = { "big_1.png", "big_2.png", "big_3.png", "big_4.png", "small_1.png", "small_2.png", "small_3.png", "small_4.png", NULL };
+	Add_Images( pImage_Set_Manager->Get( m_type, "enemy/krush/", frames ) );
 
 	m_state = STA_FALL;
 	Set_Moving_State( STA_WALK );
@@ -164,8 +159,7 @@ void cKrush :: DownGrade( bool force /* = 0 */ )
 			Col_Move( 0.0f, m_images[3].m_image->m_col_h - m_images[4].m_image->m_col_h, 1, 1 );
 
 			// animation
-			cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-			Generate_Hit_Animation( anim );
+			cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 			anim->Set_Speed( 3.5f, 0.6f );
 			anim->Set_Fading_Alpha( 1 );
 			anim->Emit();
@@ -177,8 +171,7 @@ void cKrush :: DownGrade( bool force /* = 0 */ )
 			Set_Dead( 1 );
 
 			// animation
-			cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-			Generate_Hit_Animation( anim );
+			cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 			anim->Set_Speed( 4.5f, 1.6f );
 			anim->Set_Scale( 0.6f );
 			anim->Emit();
@@ -249,8 +249,7 @@ void cRokko :: DownGrade( bool force /* = 0 */ )
 	if( !force )
 	{
 		// animation
-		cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-		Generate_Hit_Animation( anim );
+		cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 
 		anim->Set_Quota( 8 );
 		anim->Set_Speed( 4, 1 );
@@ -427,10 +426,8 @@ GL_rect cRokko :: Get_Final_Distance_Rect( void ) const
 
 void cRokko :: Generate_Smoke( unsigned int amount /* = 10 */ ) const
 {
-	cParticle_Emitter *anim = NULL;
-
 	// moving smoke particle animation
-	anim = new cParticle_Emitter( m_sprite_manager );
+	cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_ROKKO_SMOKE, m_sprite_manager );
 
 	// not dead
 	if( !m_dead )
@@ -469,14 +466,7 @@ void cRokko :: Generate_Smoke( unsigned int amount /* = 10 */ ) const
 
 	// - 0.000001f caused a weird graphical z pos bug with an ATI card
 	anim->Set_Pos_Z( m_pos_z - 0.00001f );
-	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke_grey_big.png" ) );
 	anim->Set_Quota( amount );
-	anim->Set_Time_to_Live( 0.8f, 0.8f );
-	anim->Set_Speed( 1.0f, 0.2f );
-	anim->Set_Const_Rotation_Z( -1, 2 );
-	anim->Set_Color( Color( static_cast<Uint8>(155), 150, 130 ) );
-	anim->Set_Fading_Alpha( 1 );
-	
 	anim->Emit();
 	pActive_Animation_Manager->Add( anim );
 }
@@ -484,17 +474,10 @@ void cRokko :: Generate_Smoke( unsigned int amount /* = 10 */ ) const
 void cRokko :: Generate_Sparks( unsigned int amount /* = 5 */ ) const
 {
 	// animation
-	cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
+	cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_ROKKO_SPARKS, m_sprite_manager );
 	anim->Set_Emitter_Rect( m_pos_x + m_col_rect.m_w * 0.2f, m_pos_y + m_rect.m_h * 0.2f, m_col_rect.m_w * 0.6f, m_rect.m_h * 0.6f );
 	anim->Set_Pos_Z( m_pos_z + 0.00001f );
 	anim->Set_Quota( amount );
-	anim->Set_Time_to_Live( 0.2f, 0.1f );
-	anim->Set_Speed( 1.2f, 1.1f );
-	anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
-	anim->Set_Color( Color( static_cast<Uint8>(250), 250, 200 ), Color( static_cast<Uint8>(5), 5, 0, 0 ) );
-	anim->Set_Scale( 0.3f, 0.3f );
-	anim->Set_Fading_Size( 1 );
-	anim->Set_Fading_Alpha( 0 );
 	anim->Emit();
 	pActive_Animation_Manager->Add( anim );
 }
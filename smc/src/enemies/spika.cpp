@@ -442,7 +442,7 @@ void cSpika :: Handle_Collision_Enemy( cObjectCollision *collision )
 			return;
 		}
 
-		pAudio->Play_Sound( enemy->m_kill_sound );
+		pAudio->Play_Sound_At( enemy->m_kill_sound, enemy->m_col_rect.m_x + enemy->m_col_rect.m_w * 0.5f, enemy->m_col_rect.m_y + enemy->m_col_rect.m_h * 0.5f );
 		pHud_Points->Add_Points( enemy->m_kill_points, enemy->m_pos_x, enemy->m_pos_y - 5.0f, "", static_cast<Uint8>(255), 1 );
 		enemy->DownGrade( 1 );
 	}
@@ -15,6 +15,7 @@
 
 #include "../enemies/spikeball.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../level/level_player.h"
 #include "../gui/hud.h"
 #include "../core/i18n.h"
@@ -52,6 +53,7 @@ cSpikeball :: ~cSpikeball( void )
 void cSpikeball :: Init( void )
 {
 	m_type = TYPE_SPIKEBALL;
+	m_update_animation_parallel = 1;
 	m_pos_z = 0.09f;
 	m_gravity_max = 29.0f;
 
@@ -157,15 +159,8 @@ void cSpikeball :: Set_Color( const DefaultColor &col )
 
 	Update_Velocity_Max();
 
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_1.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_2.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_3.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_4.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_5.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_6.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_7.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/walk_8.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/turn.png" ) );
+	static const char *const frames[] = { "/walk_1.png", "/walk_2.png", "/walk_3.png", "/walk_4.png", "/walk_5.png", "/walk_6.png", "/walk_7.png", "/walk_8.png", "/turn.png", NULL };
+	Add_Images( pImage_Set_Manager->Get( m_type, "enemy/spikeball/" + filename_dir, frames ) );
 	//Add_Image( pVideo->Get_Surface( "enemy/spikeball/" + filename_dir + "/dead.png" ) );
 
 	Set_Image_Num( 0, 1 );
@@ -334,7 +329,7 @@ void cSpikeball :: Update( void )
 			Set_Image_Num( 8 );
 
 			// random direction
-			if( ( rand() % 2 ) == 1 )
+			if( Get_Random_Int( 2 ) == 1 )
 			{
 				// turn around
 				m_direction = Get_Opposite_Direction( m_direction );
@@ -378,13 +373,10 @@ void cSpikeball :: Update( void )
 		// create particles
 		if( m_running_particle_counter > 1.0f )
 		{
-			cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
+			cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_RUNNING_SMOKE, m_sprite_manager );
 			anim->Set_Emitter_Rect( m_col_rect.m_x, m_col_rect.m_y + m_col_rect.m_h - 2.0f, m_col_rect.m_w );
 			anim->Set_Quota( static_cast<int>(m_running_particle_counter) );
 			anim->Set_Pos_Z( m_pos_z - 0.000001f );
-			anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke_black.png" ) );
-			anim->Set_Time_to_Live( 0.6f );
-			anim->Set_Scale( 0.2f );
 
 			float vel;
 
@@ -359,7 +359,7 @@ void cStaticEnemy :: Handle_Collision_Enemy( cObjectCollision *collision )
 	}
 
 	// kill enemy
-	pAudio->Play_Sound( enemy->m_kill_sound );
+	pAudio->Play_Sound_At( enemy->m_kill_sound, enemy->m_col_rect.m_x + enemy->m_col_rect.m_w * 0.5f, enemy->m_col_rect.m_y + enemy->m_col_rect.m_h * 0.5f );
 	pHud_Points->Add_Points( enemy->m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<Uint8>(255), 1 );
 	enemy->DownGrade( 1 );
 }
@@ -15,6 +15,7 @@
 
 #include "../enemies/thromp.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../video/animation.h"
 #include "../level/level_player.h"
 #include "../level/level.h"
@@ -173,8 +174,10 @@ void cThromp :: Set_Image_Dir( std::string dir )
 		dir.insert( dir.length(), "/" );
 	}
 
+	static const char *const frames[] = { ".png", "_active.png", NULL };
+
 	// if not image directory
-	if( !File_Exists( DATA_DIR "/" GAME_PIXMAPS_DIR "/" + dir + "up.png" ) && !File_Exists( DATA_DIR "/" GAME_PIXMAPS_DIR "/" + dir + "up.settings" ) )
+	if( !pImage_Set_Manager->Get( m_type, dir + "up", frames )->m_valid )
 	{
 		printf( "Warning : Thromp image dir does not exist %s\n", dir.c_str() );
 		return;
@@ -270,8 +273,7 @@ void cThromp :: DownGrade( bool force /* = 0 */ )
 	if( !force )
 	{
 		// animation
-		cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-		Generate_Hit_Animation( anim );
+		cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 
 		anim->Set_Scale( 0.8f );
 		anim->Set_Direction_Range( 0.0f, 360.0f );
@@ -448,8 +450,8 @@ void cThromp :: Update_Images( void )
 	// clear images
 	Clear_Images();
 	// set images
-	Add_Image( pVideo->Get_Surface( m_img_dir + Get_Direction_Name( m_start_direction ) + ".png" ) );
-	Add_Image( pVideo->Get_Surface( m_img_dir + Get_Direction_Name( m_start_direction ) + "_active.png" ) );
+	static const char *const frames[] = { ".png", "_active.png", NULL };
+	Add_Images( pImage_Set_Manager->Get( m_type, m_img_dir + Get_Direction_Name( m_start_direction ), frames ) );
 	// set start image
 	Set_Image_Num( 0, 1 );
 
@@ -613,16 +615,10 @@ void cThromp :: Generate_Smoke( unsigned int amount /* = 20 */ ) const
 	}
 
 	// animation
-	cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
+	cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_THROMP_SMOKE, m_sprite_manager );
 	anim->Set_Emitter_Rect( smoke_x, smoke_y, smoke_width, smoke_height );
-	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke.png" ) );
 	anim->Set_Quota( amount );
 	anim->Set_Pos_Z( m_pos_z + 0.000001f );
-	anim->Set_Time_to_Live( 1, 1 );
-	anim->Set_Direction_Range( 180, 180 );
-	anim->Set_Speed( 0.05f, 0.4f );
-	anim->Set_Fading_Alpha( 1 );
-	anim->Set_Const_Rotation_Z( -2, 4 );
 	anim->Emit();
 	pActive_Animation_Manager->Add( anim );
 }
@@ -730,7 +726,7 @@ void cThromp :: Handle_Collision_Enemy( cObjectCollision *collision )
 			// kill enemy
 			else
 			{
-				pAudio->Play_Sound( enemy->m_kill_sound );
+				pAudio->Play_Sound_At( enemy->m_kill_sound, enemy->m_col_rect.m_x + enemy->m_col_rect.m_w * 0.5f, enemy->m_col_rect.m_y + enemy->m_col_rect.m_h * 0.5f );
 				pHud_Points->Add_Points( enemy->m_kill_points, m_pos_x + m_image->m_w / 3, m_pos_y - 5, "", static_cast<Uint8>(255), 1 );
 				enemy->DownGrade( 1 );
 
@@ -15,6 +15,7 @@
 
 #include "../enemies/turtle.h"
 #include "../core/game_core.h"
+#include "../video/img_set.h"
 #include "../objects/box.h"
 #include "../video/animation.h"
 #include "../level/level_player.h"
@@ -56,6 +57,7 @@ cTurtle :: ~cTurtle( void )
 void cTurtle :: Init( void )
 {
 	m_type = TYPE_TURTLE;
+	m_update_animation_parallel = 1;
 	m_pos_z = 0.091f;
 	m_gravity_max = 24.0f;
 
@@ -198,24 +200,15 @@ void cTurtle :: Set_Color( DefaultColor col )
 
 	Clear_Images();
 
-	// Walk
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_1.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_2.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_3.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_4.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_5.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_6.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_7.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_8.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/walk_9.png" ) );
-	// Walk Turn
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/turn.png" ) );
-	// Shell
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/shell.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/shell_look_1.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/shell_look_2.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/shell_look_3.png" ) );
-	Add_Image( pVideo->Get_Surface( "enemy/turtle/" + filename_dir + "/roll.png" ) );
+	static const char *const frames[] = {
+		// Walk
+		"/walk_1.png", "/walk_2.png", "/walk_3.png", "/walk_4.png", "/walk_5.png", "/walk_6.png", "/walk_7.png", "/walk_8.png", "/walk_9.png",
+		// Walk Turn
+		"/turn.png",
+		// Shell
+		"/shell.png", "/shell_look_1.png", "/shell_look_2.png", "/shell_look_3.png", "/roll.png",
+		NULL };
+	Add_Images( pImage_Set_Manager->Get( m_type, "enemy/turtle/" + filename_dir, frames ) );
 
 	Set_Image_Num( 0, 1 );
 	Create_Name();
@@ -545,7 +538,7 @@ bool cTurtle :: Hit_Enemy( cEnemy *enemy )
 	}
 
 	// hit enemy
-	pAudio->Play_Sound( enemy->m_kill_sound );
+	pAudio->Play_Sound_At( enemy->m_kill_sound, enemy->m_col_rect.m_x + enemy->m_col_rect.m_w * 0.5f, enemy->m_col_rect.m_y + enemy->m_col_rect.m_h * 0.5f );
 	pHud_Points->Add_Points( enemy->m_kill_points, m_pos_x + m_image->m_w / 3, m_pos_y - 5.0f, "", static_cast<Uint8>(255), 1 );
 	enemy->DownGrade( 1 );
 	pLevel_Player->Add_Kill_Multiplier();
@@ -773,8 +766,7 @@ void cTurtle :: Handle_Collision_Player( cObjectCollision *collision )
 		}
 
 		// animation
-		cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-		Generate_Hit_Animation( anim );
+		cParticle_Emitter *anim = Generate_Hit_Animation( 0 );
 		anim->Set_Speed( 4.0f, 0.8f );
 		anim->Set_Scale( 0.6f );
 		anim->Emit();
@@ -817,15 +809,8 @@ void cTurtle :: Handle_Collision_Player( cObjectCollision *collision )
 			pAudio->Play_Sound( "enemy/turtle/shell/hit.ogg" );
 			DownGrade();
 
-			cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
-			anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
-			anim->Set_Quota( 4 );
+			cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_SHELL_HIT, m_sprite_manager );
 			anim->Set_Pos_Z( m_pos_z + 0.0001f );
-			anim->Set_Time_to_Live( 0.3f );
-			anim->Set_Speed( 4.0f, 0.5f );
-			anim->Set_Scale( 0.6f );
-			anim->Set_Fading_Size( 1 );
-			anim->Set_Color( Color( static_cast<Uint8>(254), 200, 100 ) );
 
 			if( collision->m_direction == DIR_RIGHT )
 			{
@@ -914,16 +899,9 @@ void cTurtle :: Handle_Collision_Enemy( cObjectCollision *collision )
 		if( Hit_Enemy( enemy ) )
 		{
 			// create animation
-			cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
+			cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_SHELL_KILL, m_sprite_manager );
 			anim->Set_Emitter_Rect( m_col_rect.m_x + ( m_col_rect.m_w * 0.2f ), m_col_rect.m_y + ( m_col_rect.m_h * 0.2f ), m_col_rect.m_w * 0.6f, m_col_rect.m_h * 0.8f );
-			anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
-			anim->Set_Quota( 5 );
 			anim->Set_Pos_Z( m_pos_z + 0.000001f );
-			anim->Set_Time_to_Live( 0.3f );
-			anim->Set_Speed( 1.2f, 0.8f );
-			anim->Set_Scale( 0.7f );
-			anim->Set_Fading_Alpha( 1 );
-			anim->Set_Blending( BLEND_ADD );
 
 			if( collision->m_direction == DIR_RIGHT )
 			{
@@ -963,26 +941,19 @@ void cTurtle :: Handle_Collision_Massive( cObjectCollision *collision )
 		if( collision->m_direction == DIR_RIGHT || collision->m_direction == DIR_LEFT )
 		{
 			// animation
-			cParticle_Emitter *anim = NULL;
+			cParticle_Emitter *anim = pActive_Animation_Manager->Get_Effect( PARTICLE_EFFECT_SHELL_WALL_SMOKE, m_sprite_manager );
 			if( collision->m_direction == DIR_RIGHT )
 			{
-				anim = new cParticle_Emitter( m_sprite_manager );
 				anim->Set_Pos( col_object->m_pos_x + col_object->m_col_pos.m_x + 4.0f, m_pos_y + ( m_col_rect.m_h / 1.35f ), 1 );
 				anim->Set_Direction_Range( 140.0f, 100.0f );
 			}
 			else
 			{
-				anim = new cParticle_Emitter( m_sprite_manager );
 				anim->Set_Pos( col_object->m_pos_x + col_object->m_col_pos.m_x + col_object->m_col_rect.m_w - 4.0f, m_pos_y + ( m_col_rect.m_h / 1.35f ), 1 );
 				anim->Set_Direction_Range( 320.0f, 100.0f );
 			}
 
-			anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke.png" ) );
-			anim->Set_Quota( 5 );
 			anim->Set_Pos_Z( col_object->m_pos_z - 0.0001f, 0.0002f );
-			anim->Set_Time_to_Live( 0.2f, 0.2f );
-			anim->Set_Speed( 1.0f, 1.0f );
-			anim->Set_Scale( 0.5f, 0.4f );
 			anim->Emit();
 			pActive_Animation_Manager->Add( anim );
 		}
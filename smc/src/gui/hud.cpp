@@ -882,6 +882,7 @@ cDebugDisplay :: cDebugDisplay( cSprite_Manager *sprite_manager )
 	m_mass_counter = -1;
 	m_enemy_counter = -1;
 	m_active_counter = -1;
+	m_collision_allocations_last = 0;
 
 	// debug text window
 	m_window_debug_text = CEGUI::WindowManager::getSingleton().loadWindowLayout( "debugtext.layout" );
@@ -1238,7 +1239,7 @@ void cDebugDisplay :: Draw_Performance_Debug_Mode( void )
 
 	// black background
 	Color color = blackalpha128;
-	pVideo->Draw_Rect( 15, ypos, 190, 390, m_pos_z - 0.00001f, &color );
+	pVideo->Draw_Rect( 15, ypos, 190, 530, m_pos_z - 0.00001f, &color );
 
 	// don't draw it twice
 	if( !game_debug )
@@ -1351,6 +1352,45 @@ void cDebugDisplay :: Draw_Performance_Debug_Mode( void )
 	text_strings.push_back( _("Gui : ") + int_to_string( pFramerate->m_perf_timer[PERF_RENDER_GUI]->ms ) );
 	text_strings.push_back( _("Buffer : ") + int_to_string( pFramerate->m_perf_timer[PERF_RENDER_BUFFER]->ms ) );
 
+	// render statistics of the last frame
+	const cRender_Statistics &render_statistics = Get_Render_Statistics();
+
+	if( render_statistics.m_gpu_ms < 0.0f )
+	{
+		text_strings.push_back( _("GPU : -") );
+	}
+	else
+	{
+		// milliseconds per 100 frames like the timers
+		text_strings.push_back( _("GPU : ") + int_to_string( static_cast<int>( render_statistics.m_gpu_ms * 100.0f ) ) );
+	}
+
+	text_strings.push_back( _("Renderer") );
+	text_strings.push_back( _("Requests : ") + int_to_string( render_statistics.Get_Request_Count() ) );
+	text_strings.push_back( _("Surfaces : ") + int_to_string( render_statistics.m_requests[REND_SURFACE] ) + " / " + int_to_string( render_statistics.m_requests[REND_SURFACE_BATCH] ) );
+	text_strings.push_back( _("Texture binds : ") + int_to_string( render_statistics.m_texture_binds ) );
+	text_strings.push_back( _("State changes : ") + int_to_string( render_statistics.m_blend_changes + render_statistics.m_combine_changes ) );
+	text_strings.push_back( _("Vertices : ") + int_to_string( render_statistics.m_vertices ) );
+
+	// collision memory
+	const cMemory_Pool *collision_pool = Get_Collision_Memory_Pool();
+	const unsigned int collision_allocations = collision_pool->Get_Allocation_Count();
+
+	text_strings.push_back( _("Collisions") );
+	text_strings.push_back( _("In use : ") + int_to_string( collision_pool->Get_Used_Count() ) );
+	text_strings.push_back( _("Created : ") + int_to_string( collision_allocations - m_collision_allocations_last ) );
+	// should not change once the pools are warmed up
+	text_strings.push_back( _("Memory blocks : ") + int_to_string( collision_pool->Get_Block_Count() + Get_Collision_List_Memory_Pool()->Get_Block_Count() ) );
+
+	m_collision_allocations_last = collision_allocations;
+
+	// sound memory and first play latency
+	text_strings.push_back( _("Sounds") );
+	text_strings.push_back( _("Compressed : ") + int_to_string( pSound_Manager->Get_Compressed_Size() / 1024 ) + " KB" );
+	text_strings.push_back( _("Decoded : ") + int_to_string( pSound_Manager->Get_Decoded_Size() / 1024 ) + " KB / " + int_to_string( pSound_Manager->Get_Decode_Count() ) );
+	text_strings.push_back( _("First play : ") + float_to_string( pSound_Manager->Get_Decode_Time_Last(), 2 ) + " / " + float_to_string( pSound_Manager->Get_Decode_Time_Max(), 2 ) + " ms" );
+	text_strings.push_back( _("Voices : ") + int_to_string( pAudio->m_sound_coalesced_count ) + " / " + int_to_string( pAudio->m_sound_stolen_count ) + " / " + int_to_string( pAudio->m_sound_dropped_count ) );
+
 	unsigned int pos = 0;
 
 	for( vector<std::string>::const_iterator itr = text_strings.begin(); itr != text_strings.end(); ++itr )
@@ -1360,12 +1400,12 @@ void cDebugDisplay :: Draw_Performance_Debug_Mode( void )
 		ypos += 12;
 
 		// move non header a bit to the right right
-		if( pos != 0 && pos != 7 && pos != 17 )
+		if( pos != 0 && pos != 7 && pos != 17 && pos != 22 && pos != 28 && pos != 32 )
 		{
 			xpos += 10;
 		}
 		// if new group starts move a bit more down
-		if( pos == 7 || pos == 17 )
+		if( pos == 7 || pos == 17 || pos == 22 || pos == 28 || pos == 32 )
 		{
 			ypos += 10;
 		}
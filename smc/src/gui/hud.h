@@ -263,6 +263,8 @@ public:
 	std::string m_level_old;
 	// last object counters
 	int m_obj_counter, m_pass_counter, m_mass_counter, m_enemy_counter, m_active_counter;
+	// collision pool allocations at the last performance display
+	unsigned int m_collision_allocations_last;
 	// sprites
 	typedef vector<cHudSprite *> HudSpriteList;
 	HudSpriteList m_sprites;
@@ -386,7 +386,7 @@ bool cMenuCore :: Key_Down( SDLKey key )
 			// get levels listbox
 			CEGUI::Listbox *listbox_levels = static_cast<CEGUI::Listbox *>(CEGUI::WindowManager::getSingleton().getWindow( "listbox_levels" ));
 			// select random level
-			listbox_levels->setItemSelectState( rand() % listbox_levels->getItemCount(), 1 );
+			listbox_levels->setItemSelectState( Get_Random_Int( listbox_levels->getItemCount(), RANDOM_STREAM_VISUAL ), 1 );
 			// get level name
 			lvl_name = listbox_levels->getFirstSelectedItem()->getText().c_str();
 			menu_start->Load_Level( lvl_name );
@@ -398,7 +398,7 @@ bool cMenuCore :: Key_Down( SDLKey key )
 			// Get levels listbox
 			CEGUI::Listbox *listbox_levels = static_cast<CEGUI::Listbox *>(CEGUI::WindowManager::getSingleton().getWindow( "listbox_levels" ));
 			// select random level
-			listbox_levels->setItemSelectState( rand() % listbox_levels->getItemCount(), 1 );
+			listbox_levels->setItemSelectState( Get_Random_Int( listbox_levels->getItemCount(), RANDOM_STREAM_VISUAL ), 1 );
 			// get level name
 			lvl_name = listbox_levels->getFirstSelectedItem()->getText().c_str();
 			static_cast<cMenu_Start *>(pMenuCore->m_menu_data)->Load_Level( lvl_name );
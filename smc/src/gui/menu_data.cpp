@@ -690,12 +690,22 @@ void cMenu_Start :: Load_Campaign( std::string name )
 			Game_Action = GA_ENTER_LEVEL;
 			Game_Mode_Type = MODE_TYPE_LEVEL_CUSTOM;
 			Game_Action_Data_Middle.add( "load_level", new_campaign->m_target.c_str() );
+			// read the music while the screen and the menu music fade out
+			pAudio->Prefetch_Music( pLevel_Manager->Get_Music_Filename( new_campaign->m_target ) );
 		}
 		// enter world
 		else
 		{
 			Game_Action = GA_ENTER_WORLD;
 			Game_Action_Data_Middle.add( "enter_world", new_campaign->m_target.c_str() );
+
+			cOverworld *overworld = pOverworld_Manager->Get( new_campaign->m_target );
+
+			// read the music while the screen and the menu music fade out
+			if( overworld )
+			{
+				pAudio->Prefetch_Music( overworld->m_musicfile );
+			}
 		}
 
 		Game_Action_Data_Start.add( "music_fadeout", "1000" );
@@ -734,6 +744,8 @@ void cMenu_Start :: Load_World( std::string name )
 		Game_Action_Data_Middle.add( "reset_save", "1" );
 		Game_Action_Data_End.add( "screen_fadein", CEGUI::PropertyHelper::intToString( EFFECT_IN_RANDOM ) );
 		Game_Action_Data_End.add( "screen_fadein_speed", "3" );
+		// read the music while the screen and the menu music fade out
+		pAudio->Prefetch_Music( new_world->m_musicfile );
 	}
 }
 
@@ -763,6 +775,8 @@ bool cMenu_Start :: Load_Level( std::string level_name )
 	Game_Action_Data_Middle.add( "reset_save", "1" );
 	Game_Action_Data_End.add( "screen_fadein", CEGUI::PropertyHelper::intToString( EFFECT_IN_RANDOM ) );
 	Game_Action_Data_End.add( "screen_fadein_speed", "3" );
+	// read the music while the screen and the menu music fade out
+	pAudio->Prefetch_Music( pLevel_Manager->Get_Music_Filename( level_name ) );
 
 	return 1;
 }
@@ -3119,6 +3133,8 @@ void cMenu_Savegames :: Update_Load( void )
 		if( pActive_Level->Get_Music_Filename( 1 ).compare( level->Get_Music_Filename( 1 ) ) != 0 )
 		{
 			Game_Action_Data_Start.add( "music_fadeout", "1000" );
+			// read the music while the screen and the current music fade out
+			pAudio->Prefetch_Music( level->Get_Music_Filename( 1 ) );
 		}
 	}
 	else
@@ -3491,11 +3507,11 @@ void cMenu_Credits :: Update( void )
 				if( obj->m_combine_color[0] < 1.0f )
 				{
 					cParticle_Emitter *anim = new cParticle_Emitter( pMenuCore->m_handler->m_level->m_sprite_manager );
-					anim->Set_Emitter_Rect( Get_Random_Float( game_res_w * 0.1f, game_res_w * 0.8f ), -Get_Random_Float( game_res_h * 0.8f, game_res_h * 0.9f ), Get_Random_Float( 0.0f, 5.0f ), Get_Random_Float( 0.0f, 5.0f ) );
+					anim->Set_Emitter_Rect( Get_Random_Float( game_res_w * 0.1f, game_res_w * 0.8f, RANDOM_STREAM_PARTICLE ), -Get_Random_Float( game_res_h * 0.8f, game_res_h * 0.9f, RANDOM_STREAM_PARTICLE ), Get_Random_Float( 0.0f, 5.0f, RANDOM_STREAM_PARTICLE ), Get_Random_Float( 0.0f, 5.0f, RANDOM_STREAM_PARTICLE ) );
 					unsigned int quota = 4;
 					
 					// multi-explosion
-					if( rand() % 2 )
+					if( Get_Random_Int( 2, RANDOM_STREAM_PARTICLE ) )
 					{
 						anim->Set_Image_Filename( "animation/particles/fire_2.png" );
 						anim->Set_Emitter_Time_to_Live( 0.4f );
@@ -3509,7 +3525,7 @@ void cMenu_Credits :: Update( void )
 					// star explosion
 					else
 					{
-						quota += rand() % 25;
+						quota += Get_Random_Int( 25, RANDOM_STREAM_PARTICLE );
 						anim->Set_Image_Filename( "animation/particles/fire_3.png" );
 						anim->Set_Direction_Range( 0, 360 );
 						anim->Set_Scale( 0.2f, 0.1f );
@@ -3528,7 +3544,7 @@ void cMenu_Credits :: Update( void )
 					}
 					
 					anim->Set_Quota( quota );
-					anim->Set_Color( Color( static_cast<Uint8>( 100 + ( rand() % 155 ) ), 100 + ( rand() % 155 ), 100 + ( rand() % 155 ) ) );
+					anim->Set_Color( Color( static_cast<Uint8>( 100 + Get_Random_Int( 155, RANDOM_STREAM_PARTICLE ) ), 100 + Get_Random_Int( 155, RANDOM_STREAM_PARTICLE ), 100 + Get_Random_Int( 155, RANDOM_STREAM_PARTICLE ) ) );
 					anim->Set_Const_Rotation_Z( -5, 10 );
 					anim->Set_Vertical_Gravity( 0.02f );
 					anim->Set_Pos_Z( 0.16f );
@@ -90,6 +90,11 @@ cMouseCursor :: cMouseCursor( cSprite_Manager *sprite_manager )
 	m_mover_mode = 0;
 	m_last_clicked_object = NULL;
 
+	m_object_index_valid = 0;
+	m_object_index_manager = NULL;
+	m_object_index_modification = 0;
+	m_object_index_change = 0;
+
 	Reset_Keys();
 	Update_Position();
 	// disable mouse initially
@@ -130,6 +135,7 @@ void cMouseCursor :: Reset( bool clear_copy_buffer /* = 1 */ )
 	m_selection_mode = 0;
 	m_fastcopy_mode = 0;
 
+	Clear_Object_Index();
 	Clear_Collisions();
 
 	// show mouse
@@ -762,21 +768,20 @@ bool cMouseCursor :: Add_Selected_Object( cSprite *sprite, bool from_user /* = 0
 	}
 
 	// check if not already added
-	for( SelectedObjectList::iterator itr = m_selected_objects.begin(); itr != m_selected_objects.end(); ++itr )
+	SelectedObjectMap::iterator found = m_selected_objects_map.find( sprite );
+
+	if( found != m_selected_objects_map.end() )
 	{
-		cSelectedObject *sel_obj = (*itr);
+		cSelectedObject *sel_obj = found->second;
 
-		if( sel_obj->m_obj == sprite )
+		// overwrite user if given
+		if( from_user && !sel_obj->m_user )
 		{
-			// overwrite user if given
-			if( from_user && !sel_obj->m_user )
-			{
-				sel_obj->m_user = 1;
-				return 1;
-			}
-
-			return 0;
+			sel_obj->m_user = 1;
+			return 1;
 		}
+
+		return 0;
 	}
 
 	// insert object
@@ -784,6 +789,7 @@ bool cMouseCursor :: Add_Selected_Object( cSprite *sprite, bool from_user /* = 0
 	selected_object->m_obj = sprite;
 	selected_object->m_user = from_user;
 	m_selected_objects.push_back( selected_object );
+	m_selected_objects_map[sprite] = selected_object;
 
 	Update_Selected_Object_Offset( selected_object );
 
@@ -813,26 +819,30 @@ bool cMouseCursor :: Remove_Selected_Object( const cSprite *sprite, bool no_user
 		return 0;
 	}
 
-	for( SelectedObjectList::iterator itr = m_selected_objects.begin(); itr != m_selected_objects.end(); ++itr )
+	SelectedObjectMap::iterator found = m_selected_objects_map.find( sprite );
+
+	// not selected
+	if( found == m_selected_objects_map.end() )
 	{
-		cSelectedObject *sel_obj = (*itr);
+		return 0;
+	}
 
-		if( sel_obj->m_obj == sprite )
-		{
-			// don't delete user added selected object
-			if( no_user && sel_obj->m_user )
-			{
-				return 0;
-			}
+	cSelectedObject *sel_obj = found->second;
 
-			m_selected_objects.erase( itr );
-			delete sel_obj;
-			
-			return 1;
-		}
+	// don't delete user added selected object
+	if( no_user && sel_obj->m_user )
+	{
+		return 0;
 	}
 
-	return 0;
+	m_selected_objects_map.erase( found );
+
+	// search from the back as the last selected objects are usually removed first
+	SelectedObjectList::reverse_iterator itr = std::find( m_selected_objects.rbegin(), m_selected_objects.rend(), sel_obj );
+	m_selected_objects.erase( itr.base() - 1 );
+	delete sel_obj;
+
+	return 1;
 }
 
 cSprite_List cMouseCursor :: Get_Selected_Objects( void )
@@ -901,6 +911,7 @@ void cMouseCursor :: Clear_Selected_Objects( void )
 	}
 
 	m_selected_objects.clear();
+	m_selected_objects_map.clear();
 }
 
 void cMouseCursor :: Update_Selected_Objects( void )
@@ -964,24 +975,21 @@ bool cMouseCursor :: Is_Selected_Object( const cSprite *sprite, bool only_user /
 		return 0;
 	}
 
-	for( SelectedObjectList::iterator itr = m_selected_objects.begin(); itr != m_selected_objects.end(); ++itr )
-	{
-		cSelectedObject *sel_obj = (*itr);
+	SelectedObjectMap::const_iterator found = m_selected_objects_map.find( sprite );
 
-		if( sel_obj->m_obj == sprite )
-		{
-			// if only user objects
-			if( only_user && !sel_obj->m_user )
-			{
-				continue;
-			}
+	// not found
+	if( found == m_selected_objects_map.end() )
+	{
+		return 0;
+	}
 
-			// found
-			return 1;
-		}
+	// if only user objects
+	if( only_user && !found->second->m_user )
+	{
+		return 0;
 	}
 
-	return 0;
+	return 1;
 }
 
 void cMouseCursor :: Delete_Selected_Objects( void )
@@ -994,6 +1002,85 @@ void cMouseCursor :: Delete_Selected_Objects( void )
 	Clear_Selected_Objects();
 }
 
+// Return the area enclosing the start and the current rect
+static GL_rect Get_Object_Index_Rect( const cSprite *obj )
+{
+	GL_rect rect = obj->m_start_rect;
+
+	if( obj->m_rect.m_x < rect.m_x )
+	{
+		rect.m_w += rect.m_x - obj->m_rect.m_x;
+		rect.m_x = obj->m_rect.m_x;
+	}
+	if( obj->m_rect.m_y < rect.m_y )
+	{
+		rect.m_h += rect.m_y - obj->m_rect.m_y;
+		rect.m_y = obj->m_rect.m_y;
+	}
+	if( obj->m_rect.m_x + obj->m_rect.m_w > rect.m_x + rect.m_w )
+	{
+		rect.m_w = obj->m_rect.m_x + obj->m_rect.m_w - rect.m_x;
+	}
+	if( obj->m_rect.m_y + obj->m_rect.m_h > rect.m_y + rect.m_h )
+	{
+		rect.m_h = obj->m_rect.m_y + obj->m_rect.m_h - rect.m_y;
+	}
+
+	return rect;
+}
+
+bool cMouseCursor :: Is_Object_Index_Current( void ) const
+{
+	return m_object_index_valid && m_object_index_manager == m_sprite_manager && m_object_index_modification == m_sprite_manager->Get_Modification_Count() && m_object_index_change == m_sprite_manager->Get_Change_Count();
+}
+
+void cMouseCursor :: Update_Object_Index( void )
+{
+	// still valid
+	if( Is_Object_Index_Current() )
+	{
+		return;
+	}
+
+	m_object_index.Clear();
+
+	for( cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr )
+	{
+		cSprite *obj = (*itr);
+
+		// ignore spawned or destroyed objects
+		if( obj->m_spawned || obj->m_auto_destroy )
+		{
+			continue;
+		}
+
+		m_object_index.Add( obj, Get_Object_Index_Rect( obj ) );
+	}
+
+	m_object_index_valid = 1;
+	m_object_index_manager = m_sprite_manager;
+	m_object_index_modification = m_sprite_manager->Get_Modification_Count();
+	m_object_index_change = m_sprite_manager->Get_Change_Count();
+}
+
+void cMouseCursor :: Move_Index_Object( cSprite *obj )
+{
+	m_object_index.Move( obj, Get_Object_Index_Rect( obj ) );
+	m_object_index_change = m_sprite_manager->Get_Change_Count();
+}
+
+void cMouseCursor :: Clear_Object_Index( void )
+{
+	m_object_index_valid = 0;
+	m_object_index.Clear();
+}
+
+void cMouseCursor :: Get_Index_Objects( cSprite_List &objects, const GL_rect &rect )
+{
+	Update_Object_Index();
+	m_object_index.Get_Objects( objects, rect );
+}
+
 bool cMouseCursor :: Get_Snap_Pos( GL_point &new_pos, int snap, cSelectedObject *src_obj )
 {
 	GL_rect src_rect;
@@ -1031,8 +1118,12 @@ bool cMouseCursor :: Get_Snap_Pos( GL_point &new_pos, int snap, cSelectedObject
 	int num_snap_obj = 0;
 	cSprite *snap_obj = NULL;
 
+	// get the objects near the snap area
+	cSprite_List snap_objects;
+	Get_Index_Objects( snap_objects, full_snap_rect );
+
 	// check objects for overlap
-	for( cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr )
+	for( cSprite_List::iterator itr = snap_objects.begin(); itr != snap_objects.end(); ++itr )
 	{
 		cSprite *obj = (*itr);
 
@@ -1377,6 +1468,9 @@ void cMouseCursor :: Delete( cSprite *sprite )
 
 void cMouseCursor :: Set_Object_Position( cSelectedObject *sel_obj )
 {
+	// the index stays valid if only this object is moved
+	const bool index_current = Is_Object_Index_Current();
+
 	// if in snap mode and snap available
 	if( m_snap_to_object_mode && m_snap_pos_available )
 	{
@@ -1393,6 +1487,11 @@ void cMouseCursor :: Set_Object_Position( cSelectedObject *sel_obj )
 	{
 		m_active_object->Editor_Position_Update();
 	}
+
+	if( index_current )
+	{
+		Move_Index_Object( sel_obj->m_obj );
+	}
 }
 
 void cMouseCursor :: Draw_Object_Rects( void )
@@ -1504,6 +1603,7 @@ void cMouseCursor :: Draw_Object_Rects( void )
 
 void cMouseCursor :: Start_Selection( void )
 {
+	Clear_Object_Index();
 	Clear_Hovered_Object();
 	m_selection_mode = 1;
 	m_selection_rect.m_x = m_x + pActive_Camera->m_x;
@@ -1565,8 +1665,12 @@ void cMouseCursor :: Update_Selection( void )
 		Clear_Selected_Objects();
 	}
 
+	// get the objects near the selection rect
+	cSprite_List sel_objects;
+	Get_Index_Objects( sel_objects, rect );
+
 	// add selected objects
-	for( cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr )
+	for( cSprite_List::iterator itr = sel_objects.begin(); itr != sel_objects.end(); ++itr )
 	{
 		cSprite *obj = (*itr);
 
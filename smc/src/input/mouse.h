@@ -20,6 +20,8 @@
 #include "../objects/movingsprite.h"
 #include "../core/math/rect.h"
 #include "../core/math/vector.h"
+#include "../core/spatial_grid.h"
+#include <boost/unordered_map.hpp>
 
 namespace SMC
 {
@@ -43,6 +45,7 @@ public:
 };
 
 typedef vector<cSelectedObject *> SelectedObjectList;
+typedef boost::unordered_map<const cSprite *, cSelectedObject *> SelectedObjectMap;
 
 /* *** *** *** *** *** *** cCopyObject *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -180,6 +183,26 @@ public:
 		return m_selected_objects.size();
 	}
 
+	// ## Object Index
+	// Return true if the object index is built from the current sprite manager state
+	bool Is_Object_Index_Current( void ) const;
+	/* Rebuild the object index if not valid
+	 * it contains all not spawned objects from the sprite manager
+	*/
+	void Update_Object_Index( void );
+	/* Move the indexed object to its current rect
+	 * the index must have been current before the object was moved
+	*/
+	void Move_Index_Object( cSprite *obj );
+	/* Invalidate the object index
+	 * it is rebuilt on the next snap or selection query
+	*/
+	void Clear_Object_Index( void );
+	/* Add the objects which could intersect the given rect
+	 * the result must still be tested against the exact object rect
+	*/
+	void Get_Index_Objects( cSprite_List &objects, const GL_rect &rect );
+
 	// ## Snap Object
 	/* set new_pos of the nearest object in the snap range using the given object as the source
 	 * returns 0 if no object found
@@ -248,6 +271,8 @@ public:
 	 * the mouse object is also always a selected object
 	*/
 	SelectedObjectList m_selected_objects;
+	// selected objects lookup by sprite
+	SelectedObjectMap m_selected_objects_map;
 	// currently colliding object with the mouse
 	cSelectedObject *m_hovering_object;
 	// objects selected for copying
@@ -260,6 +285,15 @@ public:
 	bool m_right;
 	bool m_middle;
 
+	// spatial index of the sprite manager objects for snapping and selection
+	cSpatial_Grid<cSprite *> m_object_index;
+	// if the object index is valid
+	bool m_object_index_valid;
+	// sprite manager and its modification and change count the index was built from
+	cSprite_Manager *m_object_index_manager;
+	unsigned int m_object_index_modification;
+	unsigned int m_object_index_change;
+
 	// last clicked object
 	cSprite *m_last_clicked_object;
 	// counter for catching double-clicks
@@ -165,6 +165,10 @@ bool cLevel :: Load( std::string filename )
 {
 	m_next_level_filename.clear();
 
+	// file checks before loading
+	const unsigned int index_hits = pResource_Manager->Get_Index_Hits();
+	const unsigned int index_fallbacks = pResource_Manager->Get_Index_Fallbacks();
+
 	if( !pLevel_Manager->Get_Path( filename ) )
 	{
 		// show error without directory and file type
@@ -219,6 +223,11 @@ bool cLevel :: Load( std::string filename )
 		m_engine_version = 0;
 	}
 
+	if( game_debug )
+	{
+		printf( "Level %s : %u file checks answered by the file index, %u file system checks\n", Trim_Filename( filename, 0, 0 ).c_str(), pResource_Manager->Get_Index_Hits() - index_hits, pResource_Manager->Get_Index_Fallbacks() - index_fallbacks );
+	}
+
 	return 1;
 }
 
@@ -297,6 +306,8 @@ void cLevel :: Save( void )
 		return;
 	}
 
+	pResource_Manager->Set_Indexed_File( m_level_filename, 1 );
+
 	CEGUI::XMLSerializer stream( file );
 
 	// begin
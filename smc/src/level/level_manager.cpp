@@ -24,6 +24,7 @@
 #include "../level/level_editor.h"
 #include "../core/filesystem/resource_manager.h"
 #include "../input/mouse.h"
+#include "../core/property_helper.h"
 
 namespace SMC
 {
@@ -155,6 +156,69 @@ cLevel *cLevel_Manager :: Get( const std::string &str )
 	return NULL;
 }
 
+std::string cLevel_Manager :: Get_Music_Filename( std::string filename )
+{
+	cLevel *level = Get( filename );
+
+	// already loaded
+	if( level )
+	{
+		return level->Get_Music_Filename( 1 );
+	}
+
+	// only the new level format
+	if( !Get_Path( filename ) || filename.rfind( ".smclvl" ) == std::string::npos )
+	{
+		return "";
+	}
+
+#ifdef _WIN32
+	ifstream ifs( utf8_to_ucs2( filename ).c_str(), ios::in );
+#else
+	ifstream ifs( filename.c_str(), ios::in );
+#endif
+
+	std::string line;
+
+	// the music is a property of the settings at the start of the file
+	while( std::getline( ifs, line ) )
+	{
+		std::string::size_type pos = line.find( "name=\"lvl_music\"" );
+
+		if( pos == std::string::npos )
+		{
+			// no music set
+			if( line.find( "</settings>" ) != std::string::npos )
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		pos = line.find( "value=\"", pos );
+
+		if( pos == std::string::npos )
+		{
+			break;
+		}
+
+		pos += 7;
+		const std::string::size_type end = line.find( '"', pos );
+
+		if( end == std::string::npos )
+		{
+			break;
+		}
+
+		std::string music = xml_string_to_string( line.substr( pos, end - pos ) );
+		Convert_Path_Separators( music );
+		return music;
+	}
+
+	return "";
+}
+
 bool cLevel_Manager :: Get_Path( std::string &filename, bool check_only_user_dir /* = 0 */ ) const
 {
 	filename = Trim_Filename( filename, 0, 0 );
@@ -499,6 +563,8 @@ void cLevel_Manager :: Goto_Sub_Level( std::string str_level, const std::string
 			if( pActive_Level->Get_Music_Filename( 1 ).compare( level->Get_Music_Filename( 1 ) ) != 0 )
 			{
 				Game_Action_Data_Start.add( "music_fadeout", "1000" );
+				// read the music while the screen and the current music fade out
+				pAudio->Prefetch_Music( level->Get_Music_Filename( 1 ) );
 			}
 			Game_Action_Data_Start.add( "screen_fadeout", CEGUI::PropertyHelper::intToString( EFFECT_OUT_HORIZONTAL_VERTICAL ) );
 			Game_Action_Data_Start.add( "screen_fadeout_speed", "3" );
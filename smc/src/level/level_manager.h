@@ -58,6 +58,11 @@ public:
 	* check_only_user_dir : only check user directory for the level
 	*/
 	bool Get_Path( std::string &filename, bool check_only_user_dir = 0 ) const;
+	/* Return the music filename of the level without the music directory
+	 * only reads the level settings if the level is not loaded
+	 * returns empty if not available
+	*/
+	std::string Get_Music_Filename( std::string filename );
 	// update
 	void Update( void );
 	// draw
@@ -2550,8 +2550,8 @@ void cLevel_Player :: Draw( cSurface_Request *request /* = NULL */ )
 		for( unsigned int i = 0; i < 5; i++ )
 		{
 			m_color.alpha -= 5;
-			m_pos_x -= m_velx * 0.2f + Get_Random_Float( 0, 1 );
-			m_pos_y -= m_vely * 0.2f + Get_Random_Float( 0, 1 );
+			m_pos_x -= m_velx * 0.2f + Get_Random_Float( 0, 1, RANDOM_STREAM_VISUAL );
+			m_pos_y -= m_vely * 0.2f + Get_Random_Float( 0, 1, RANDOM_STREAM_VISUAL );
 			m_pos_z -= 0.000001f;
 
 			cMovingSprite::Draw( request );
@@ -4243,7 +4243,7 @@ void cLevel_Player :: Handle_Collision_Enemy( cObjectCollision *collision )
 		cParticle_Emitter *anim = new cParticle_Emitter( m_sprite_manager );
 		anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
 		anim->Set_Time_to_Live( 0.6f, 0.4f );
-		anim->Set_Color( Color( static_cast<Uint8>(160), 160, 240 ), Color( static_cast<Uint8>( rand() % 80 ), rand() % 80, rand() % 10, 0 ) );
+		anim->Set_Color( Color( static_cast<Uint8>(160), 160, 240 ), Color( static_cast<Uint8>( Get_Random_Int( 80, RANDOM_STREAM_PARTICLE ) ), Get_Random_Int( 80, RANDOM_STREAM_PARTICLE ), Get_Random_Int( 10, RANDOM_STREAM_PARTICLE ), 0 ) );
 		anim->Set_Fading_Alpha( 1 );
 		anim->Set_Fading_Size( 1 );
 		anim->Set_Speed( 0.5f, 0.2f );
@@ -4378,7 +4378,7 @@ void cLevel_Player :: Handle_Collision_Massive( cObjectCollision *collision )
 					anim->Set_Quota( 4 );
 					anim->Set_Pos_Z( m_pos_z - 0.000001f );
 					anim->Set_Time_to_Live( 0.3f );
-					anim->Set_Color( Color( static_cast<Uint8>(150), 150, 150, 200 ), Color( static_cast<Uint8>( rand() % 55 ), rand() % 55, rand() % 55, 0 ) );
+					anim->Set_Color( Color( static_cast<Uint8>(150), 150, 150, 200 ), Color( static_cast<Uint8>( Get_Random_Int( 55, RANDOM_STREAM_PARTICLE ) ), Get_Random_Int( 55, RANDOM_STREAM_PARTICLE ), Get_Random_Int( 55, RANDOM_STREAM_PARTICLE ), 0 ) );
 					anim->Set_Speed( 2, 0.6f );
 					anim->Set_Scale( 0.6f );
 					anim->Set_Direction_Range( 0, 180 );
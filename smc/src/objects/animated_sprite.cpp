@@ -16,6 +16,7 @@
 #include "../objects/animated_sprite.h"
 #include "../core/game_core.h"
 #include "../core/framerate.h"
+#include "../video/img_set.h"
 
 namespace SMC
 {
@@ -45,6 +46,9 @@ cAnimated_Sprite :: cAnimated_Sprite( cSprite_Manager *sprite_manager, std::stri
 	m_anim_img_end = 0;
 	m_anim_time_default = 1000;
 	m_anim_counter = 0;
+	m_anim_time_updated = 0;
+	m_anim_img_next = 0;
+	m_anim_counter_next = 0;
 	m_anim_mod = 1.0f;
 }
 
@@ -68,8 +72,31 @@ void cAnimated_Sprite :: Add_Image( cGL_Surface *image, Uint32 time /* = 0 */ )
 	m_images.push_back( obj );
 }
 
+void cAnimated_Sprite :: Add_Images( const cImage_Set *image_set, Uint32 time /* = 0 */ )
+{
+	// set to default time
+	if( time == 0 )
+	{
+		time = m_anim_time_default;
+	}
+
+	m_images.reserve( m_images.size() + image_set->m_images.size() );
+
+	cAnimation_Surface obj;
+	obj.m_time = time;
+
+	for( vector<cGL_Surface *>::const_iterator itr = image_set->m_images.begin(); itr != image_set->m_images.end(); ++itr )
+	{
+		obj.m_image = (*itr);
+		m_images.push_back( obj );
+	}
+}
+
 void cAnimated_Sprite :: Set_Image_Num( const int num, const bool new_startimage /* = 0 */, const bool del_img /* = 0 */ )
 {
+	// a selected next image is outdated
+	m_anim_time_updated = 0;
+
 	if( m_curr_img == num )
 	{
 		return;
@@ -107,40 +134,59 @@ void cAnimated_Sprite :: Clear_Images( void )
 	m_images.clear();
 }
 
-void cAnimated_Sprite :: Update_Animation( void )
+void cAnimated_Sprite :: Update_Animation_Time( void )
 {
+	// already updated
+	if( m_anim_time_updated )
+	{
+		return;
+	}
+
+	m_anim_time_updated = 1;
+	m_anim_img_next = m_curr_img;
+	m_anim_counter_next = m_anim_counter;
+
 	// if not valid
 	if( !m_anim_enabled || m_anim_img_end == 0 )
 	{
 		return;
 	}
 
-	m_anim_counter += pFramerate->m_elapsed_ticks;
+	m_anim_counter_next += pFramerate->m_elapsed_ticks;
 
 	// out of range
 	if( m_curr_img < 0 || m_curr_img >= static_cast<int>(m_images.size()) )
 	{
-		Set_Image_Num( m_anim_img_start );
+		m_anim_img_next = m_anim_img_start;
 		return;
 	}
 
-	cAnimation_Surface image = m_images[m_curr_img];
+	const cAnimation_Surface &image = m_images[m_curr_img];
 
-	if( static_cast<Uint32>(m_anim_counter * m_anim_mod) >= image.m_time )
+	if( static_cast<Uint32>(m_anim_counter_next * m_anim_mod) >= image.m_time )
 	{
 		if( m_curr_img >= m_anim_img_end )
 		{
-			Set_Image_Num( m_anim_img_start );
+			m_anim_img_next = m_anim_img_start;
 		}
 		else
 		{
-			Set_Image_Num( m_curr_img + 1 );
+			m_anim_img_next = m_curr_img + 1;
 		}
 		
-		m_anim_counter = static_cast<Uint32>(m_anim_counter * m_anim_mod) - image.m_time;
+		m_anim_counter_next = static_cast<Uint32>(m_anim_counter_next * m_anim_mod) - image.m_time;
 	}
 }
 
+void cAnimated_Sprite :: Update_Animation( void )
+{
+	Update_Animation_Time();
+	m_anim_time_updated = 0;
+	m_anim_counter = m_anim_counter_next;
+
+	Set_Image_Num( m_anim_img_next );
+}
+
 void cAnimated_Sprite :: Set_Time_All( const Uint32 time, const bool default_time /* = 0 */ )
 {
 	for( cAnimation_Surface_List::iterator itr = m_images.begin(); itr != m_images.end(); ++itr )
@@ -21,6 +21,8 @@
 namespace SMC
 {
 
+class cImage_Set;
+
 /* *** *** *** *** *** *** *** cAnimation_Surface *** *** *** *** *** *** *** *** *** *** */
 
 class cAnimation_Surface
@@ -48,6 +50,10 @@ public:
 	 * time: if not set uses the default display time
 	*/
 	void Add_Image( cGL_Surface *image, Uint32 time = 0 );
+	/* Add all images of the shared image set to the animation
+	 * time: if not set uses the default display time
+	*/
+	void Add_Images( const cImage_Set *image_set, Uint32 time = 0 );
 	// Set the animation start and end image
 	inline void Set_Animation_Image_Range( const int start, const int end )
 	{
@@ -75,9 +81,19 @@ public:
 	inline void Reset_Animation( void )
 	{
 		m_anim_counter = 0;
+		// a selected next image is outdated
+		m_anim_time_updated = 0;
 	};
 
-	// update animation
+	/* Update the animation time and select the next image
+	 * only changes this object and can be used in Update_Parallel
+	 * the image and the animation counter are set with the next Update_Animation
+	 * the result is discarded if the image is set or the animation is reset before
+	*/
+	void Update_Animation_Time( void );
+	/* update animation
+	 * uses the animation time from Update_Animation_Time if it was updated since the last call
+	*/
 	void Update_Animation( void );
 
 	// Set default image display time
@@ -116,6 +132,12 @@ public:
 	Uint32 m_anim_counter;
 	// animation speed modifier
 	float m_anim_mod;
+	// if the animation time is updated and the next image is not set yet
+	bool m_anim_time_updated;
+	// next image array number selected by the animation time update
+	int m_anim_img_next;
+	// animation counter after the animation time update
+	Uint32 m_anim_counter_next;
 
 	// Surface list
 	typedef vector<cAnimation_Surface> cAnimation_Surface_List;
@@ -345,7 +345,7 @@ void cBall :: Generate_Particles( cParticle_Emitter *anim /* = NULL */ ) const
 	anim->Set_Pos_Z( m_pos_z + 0.0001f );
 	if( m_ball_type == FIREBALL_DEFAULT )
 	{
-		unsigned int rand_image = rand() % 3;
+		unsigned int rand_image = Get_Random_Int( 3, RANDOM_STREAM_PARTICLE );
 
 		if( rand_image == 0 )
 		{
@@ -514,12 +514,12 @@ void cBall :: Handle_Collision_Enemy( cObjectCollision *collision )
 				if( m_ball_type == FIREBALL_DEFAULT )
 				{
 					anim_color = Color( static_cast<Uint8>(250), 170, 150 );
-					anim_color_rand = Color( static_cast<Uint8>( rand() % 5 ), rand() % 85, rand() % 25, 0 );
+					anim_color_rand = Color( static_cast<Uint8>( Get_Random_Int( 5, RANDOM_STREAM_PARTICLE ) ), Get_Random_Int( 85, RANDOM_STREAM_PARTICLE ), Get_Random_Int( 25, RANDOM_STREAM_PARTICLE ), 0 );
 				}
 				else
 				{
 					anim_color = Color( static_cast<Uint8>(150), 150, 240 );
-					anim_color_rand = Color( static_cast<Uint8>( rand() % 80 ), rand() % 80, rand() % 10, 0 );
+					anim_color_rand = Color( static_cast<Uint8>( Get_Random_Int( 80, RANDOM_STREAM_PARTICLE ) ), Get_Random_Int( 80, RANDOM_STREAM_PARTICLE ), Get_Random_Int( 10, RANDOM_STREAM_PARTICLE ), 0 );
 				}
 				anim->Set_Color( anim_color, anim_color_rand );
 				anim->Emit();
@@ -529,7 +529,7 @@ void cBall :: Handle_Collision_Enemy( cObjectCollision *collision )
 		pActive_Animation_Manager->Add( anim );
 
 		// play enemy kill sound
-		pAudio->Play_Sound( enemy->m_kill_sound );
+		pAudio->Play_Sound_At( enemy->m_kill_sound, enemy->m_col_rect.m_x + enemy->m_col_rect.m_w * 0.5f, enemy->m_col_rect.m_y + enemy->m_col_rect.m_h * 0.5f );
 
 		if( m_ball_type == FIREBALL_DEFAULT )
 		{
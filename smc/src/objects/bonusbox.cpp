@@ -264,7 +264,7 @@ void cBonusBox :: Activate( void )
 	// random
 	if( box_type == TYPE_POWERUP )
 	{
-		int r = rand() % 5;
+		int r = Get_Random_Int( 5 );
 
 		if( r == 0 )
 		{
@@ -455,7 +455,7 @@ void cBaseBox :: Col_Enemy( cSprite *obj )
 	if( obj->m_type == TYPE_FURBALL || obj->m_type == TYPE_TURTLE || obj->m_type == TYPE_KRUSH )
 	{
 		cEnemy *enemy = static_cast<cEnemy *>(obj);
-		pAudio->Play_Sound( enemy->m_kill_sound );
+		pAudio->Play_Sound_At( enemy->m_kill_sound, enemy->m_col_rect.m_x + enemy->m_col_rect.m_w * 0.5f, enemy->m_col_rect.m_y + enemy->m_col_rect.m_h * 0.5f );
 		pHud_Points->Add_Points( enemy->m_kill_points, enemy->m_pos_x, enemy->m_pos_y - 5.0f, "", static_cast<Uint8>(255), 1 );
 		pLevel_Player->Add_Kill_Multiplier();
 		enemy->DownGrade( 1 );
@@ -398,7 +398,7 @@ cFGoldpiece :: cFGoldpiece( cSprite_Manager *sprite_manager, ObjectDirection dir
 	// set a random direction
 	else
 	{
-		if( rand() % 2 != 1 )
+		if( Get_Random_Int( 2 ) != 1 )
 		{
 			m_direction = DIR_LEFT;
 		}
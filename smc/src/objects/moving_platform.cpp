@@ -930,6 +930,8 @@ void cMoving_Platform :: Update_Rect( void )
 	// set width
 	m_col_rect.m_w = m_rect.m_w;
 	m_start_rect.m_w = m_rect.m_w;
+
+	Update_Hot_Data();
 }
 
 void cMoving_Platform :: Update_Velocity( void )
@@ -158,87 +158,216 @@ void cMovingSprite :: Move( float move_x, float move_y, bool real /* = 0 */ )
 	Check_And_Handle_Out_Of_Level( move_x, move_y );
 }
 
-cObjectCollisionType *cMovingSprite :: Col_Move_in_Steps( float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal /* = 0 */ )
+cObjectCollisionType *cMovingSprite :: Col_Move_Swept( float move_x, float move_y, float step_size_x, float step_size_y, cSprite_List sprite_list )
 {
-	if( sprite_list.empty() )
-	{
-		cSprite::Move( final_pos_x - m_pos_x, final_pos_y - m_pos_y, 1 );
-		return NULL;
-	}
+	const float final_pos_x = m_pos_x + move_x;
+	const float final_pos_y = m_pos_y + move_y;
 
 	// collision list
 	cObjectCollisionType *col_list = new cObjectCollisionType();
 
-	bool move_x_valid = 1;
-	bool move_y_valid = 1;
-
-	/* Checks in both directions simultaneously
-	 * if a collision occurs it saves the direction
+	/* Every iteration reaches the final position, blocks an axis, removes an object or steps to an object
+	 * so this only runs more than a few times if passing many internal or invalid objects
 	*/
-	while( move_x_valid || move_y_valid )
+	unsigned int iterations_left = sprite_list.size() + 3;
+
+	while( !Is_Float_Equal( move_x, 0.0f ) || !Is_Float_Equal( move_y, 0.0f ) )
 	{
-		if( move_x_valid )
+		// move the rest in pixel steps
+		if( !iterations_left )
 		{
-			// nothing to do
-			if( Is_Float_Equal( step_size_x, 0.0f ) )
-			{
-				move_x_valid = 0;
-				continue;
-			}
+			cObjectCollisionType *col_list_temp = Col_Move_in_Steps( Is_Float_Equal( move_x, 0.0f ) ? 0.0f : step_size_x, Is_Float_Equal( move_y, 0.0f ) ? 0.0f : step_size_y, m_pos_x + move_x, m_pos_y + move_y, sprite_list );
 
-			// collision check
-			cObjectCollisionType *col_list_temp = Collision_Check_Relative( step_size_x, 0.0f, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list );
-			
-			bool collision_found = 0;
+			col_list->objects.insert( col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end() );
+			col_list_temp->objects.clear();
+			delete col_list_temp;
+			break;
+		}
+
+		iterations_left--;
 
-			// stop on everything
-			if( stop_on_internal )
+		// find the earliest contact with the remaining move
+		cSprite *hit_obj = NULL;
+		float hit_time = 2.0f;
+		// entry time on the other axis
+		float hit_time_other = 0.0f;
+		// if the contact is on the horizontal axis
+		bool hit_axis_x = 0;
+
+		for( cSprite_List::iterator itr = sprite_list.begin(); itr != sprite_list.end(); ++itr )
+		{
+			const GL_rect &rect = (*itr)->m_col_rect;
+			// time interval in which the rects intersect on each axis
+			float entry_x, exit_x, entry_y, exit_y;
+
+			if( Is_Float_Equal( move_x, 0.0f ) )
 			{
-				if( col_list_temp->size() )
+				// touching also counts as intersection
+				if( m_col_rect.m_x > rect.m_x + rect.m_w || m_col_rect.m_x + m_col_rect.m_w < rect.m_x )
 				{
-					collision_found = 1;
+					continue;
 				}
+
+				entry_x = -std::numeric_limits<float>::max();
+				exit_x = std::numeric_limits<float>::max();
+			}
+			else if( move_x > 0.0f )
+			{
+				entry_x = ( rect.m_x - ( m_col_rect.m_x + m_col_rect.m_w ) ) / move_x;
+				exit_x = ( rect.m_x + rect.m_w - m_col_rect.m_x ) / move_x;
 			}
-			// stop only on blocking
 			else
 			{
-				if( col_list_temp->Is_Included( COL_VTYPE_BLOCKING ) )
+				entry_x = ( rect.m_x + rect.m_w - m_col_rect.m_x ) / move_x;
+				exit_x = ( rect.m_x - ( m_col_rect.m_x + m_col_rect.m_w ) ) / move_x;
+			}
+
+			if( Is_Float_Equal( move_y, 0.0f ) )
+			{
+				if( m_col_rect.m_y > rect.m_y + rect.m_h || m_col_rect.m_y + m_col_rect.m_h < rect.m_y )
 				{
-					collision_found = 1;
+					continue;
 				}
-				// remove internal collision from further checks
-				else if( col_list_temp->objects.size() )
-				{
-					for( cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr )
-					{
-						cObjectCollision *col = (*itr);
 
-						if( col->m_valid_type != COL_VTYPE_INTERNAL )
-						{
-							continue;
-						}
+				entry_y = -std::numeric_limits<float>::max();
+				exit_y = std::numeric_limits<float>::max();
+			}
+			else if( move_y > 0.0f )
+			{
+				entry_y = ( rect.m_y - ( m_col_rect.m_y + m_col_rect.m_h ) ) / move_y;
+				exit_y = ( rect.m_y + rect.m_h - m_col_rect.m_y ) / move_y;
+			}
+			else
+			{
+				entry_y = ( rect.m_y + rect.m_h - m_col_rect.m_y ) / move_y;
+				exit_y = ( rect.m_y - ( m_col_rect.m_y + m_col_rect.m_h ) ) / move_y;
+			}
+
+			const float entry = entry_x > entry_y ? entry_x : entry_y;
+			const float exit = exit_x < exit_y ? exit_x : exit_y;
+
+			// no contact in this move
+			if( entry > exit || entry > 1.0f || exit < 0.0f )
+			{
+				continue;
+			}
+
+			if( entry < hit_time )
+			{
+				hit_obj = (*itr);
+				hit_time = entry;
+				hit_axis_x = entry_x >= entry_y;
+				hit_time_other = hit_axis_x ? entry_y : entry_x;
+			}
+		}
+
+		// free move
+		if( !hit_obj )
+		{
+			if( !Is_Float_Equal( move_x, 0.0f ) )
+			{
+				m_pos_x = final_pos_x;
+			}
+			if( !Is_Float_Equal( move_y, 0.0f ) )
+			{
+				m_pos_y = final_pos_y;
+			}
+
+			Update_Position_Rect();
+			break;
+		}
+
+		/* stop one step before the contact on the contact axis
+		 * the other axis moves until it overlaps the object
+		 * so the step check below finds the same collisions the pixel stepping found
+		*/
+		float &hit_move = hit_axis_x ? move_x : move_y;
+		float &other_move = hit_axis_x ? move_y : move_x;
+		const float hit_step = hit_axis_x ? step_size_x : step_size_y;
+		float stop_time = hit_time - ( hit_step / hit_move );
 
-						// find in sprite list
-						cSprite_List::iterator sprite_itr = std::find( sprite_list.begin(), sprite_list.end(), col->m_obj );
+		if( stop_time < 0.0f )
+		{
+			stop_time = 0.0f;
+		}
 
-						// not found
-						if( sprite_itr == sprite_list.end() )
-						{
-							continue;
-						}
+		const float other_time = hit_time_other > stop_time ? hit_time_other : stop_time;
+		const float hit_dist = hit_move * stop_time;
+		const float other_dist = other_move * other_time;
 
-						sprite_list.erase( sprite_itr );
+		hit_move -= hit_dist;
+		other_move -= other_dist;
+
+		if( hit_axis_x )
+		{
+			m_pos_x += hit_dist;
+			m_pos_y += other_dist;
+		}
+		else
+		{
+			m_pos_x += other_dist;
+			m_pos_y += hit_dist;
+		}
+
+		Update_Position_Rect();
+
+		bool hit_obj_found = 0;
+
+		// check the contact axis first
+		for( unsigned int i = 0; i < 2; i++ )
+		{
+			const bool check_x = ( i == 0 ) == hit_axis_x;
+			const float step = check_x ? step_size_x : step_size_y;
+
+			if( Is_Float_Equal( check_x ? move_x : move_y, 0.0f ) )
+			{
+				continue;
+			}
+
+			cObjectCollisionType *col_list_temp = Collision_Check_Relative( check_x ? step : 0.0f, check_x ? 0.0f : step, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list );
+
+			if( col_list_temp->Is_Included( hit_obj ) )
+			{
+				hit_obj_found = 1;
+			}
+
+			// stop on blocking
+			if( col_list_temp->Is_Included( COL_VTYPE_BLOCKING ) )
+			{
+				if( check_x )
+				{
+					move_x = 0.0f;
+				}
+				else
+				{
+					move_y = 0.0f;
+				}
+			}
+			// remove internal collision from further checks
+			else
+			{
+				for( cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr )
+				{
+					cObjectCollision *col = (*itr);
+
+					if( col->m_valid_type != COL_VTYPE_INTERNAL )
+					{
+						continue;
 					}
 
-					// if no objects left
-					if( sprite_list.empty() )
+					// find in sprite list
+					cSprite_List::iterator sprite_itr = std::find( sprite_list.begin(), sprite_list.end(), col->m_obj );
+
+					// not found
+					if( sprite_itr == sprite_list.end() )
 					{
-						// move to final position
-						m_pos_x = final_pos_x;
+						continue;
 					}
+
+					sprite_list.erase( sprite_itr );
 				}
 			}
-			
+
 			if( col_list_temp->size() )
 			{
 				col_list->objects.insert( col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end() );
@@ -246,91 +375,118 @@ cObjectCollisionType *cMovingSprite :: Col_Move_in_Steps( float move_x, float mo
 			}
 
 			delete col_list_temp;
+		}
 
-			if( !collision_found )
+		// contact found by the check
+		if( hit_obj_found )
+		{
+			continue;
+		}
+
+		// check if the object is a valid collision at this position
+		cSprite_List hit_list( 1, hit_obj );
+		cObjectCollisionType *col_list_hit = Collision_Check( hit_obj->m_col_rect, COLLIDE_COMPLETE, &hit_list );
+		const bool hit_obj_valid = col_list_hit->size() > 0;
+		delete col_list_hit;
+
+		// not valid
+		if( !hit_obj_valid )
+		{
+			cSprite_List::iterator sprite_itr = std::find( sprite_list.begin(), sprite_list.end(), hit_obj );
+
+			if( sprite_itr != sprite_list.end() )
 			{
-				m_pos_x += step_size_x;
+				sprite_list.erase( sprite_itr );
+			}
 
-				if( ( step_size_x > 0.0f && final_pos_x <= m_pos_x ) || ( step_size_x < 0.0f && final_pos_x >= m_pos_x ) )
-				{
-					m_pos_x = final_pos_x;
-					move_x_valid = 0;
-					step_size_x = 0.0f;
-				}
+			continue;
+		}
+
+		// not reached yet so retry one step nearer
+		if( !Is_Float_Equal( hit_move, 0.0f ) )
+		{
+			const float step = std::fabs( hit_step ) < std::fabs( hit_move ) ? hit_step : hit_move;
+
+			hit_move -= step;
 
-				// update collision rects
-				Update_Position_Rect();
+			if( hit_axis_x )
+			{
+				m_pos_x += step;
 			}
-			// collision found
 			else
 			{
-				step_size_x = 0.0f;
-				move_x_valid = 0;
+				m_pos_y += step;
 			}
+
+			Update_Position_Rect();
 		}
+	}
 
-		if( move_y_valid )
+	return col_list;
+}
+
+cObjectCollisionType *cMovingSprite :: Col_Move_in_Steps( float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List &sprite_list )
+{
+	// collision list
+	cObjectCollisionType *col_list = new cObjectCollisionType();
+
+	bool move_x_valid = 1;
+	bool move_y_valid = 1;
+
+	/* Checks in both directions simultaneously
+	 * if a collision occurs it saves the direction
+	*/
+	while( move_x_valid || move_y_valid )
+	{
+		for( unsigned int i = 0; i < 2; i++ )
 		{
+			const bool check_x = i == 0;
+			bool &move_valid = check_x ? move_x_valid : move_y_valid;
+			float &step_size = check_x ? step_size_x : step_size_y;
+
+			if( !move_valid )
+			{
+				continue;
+			}
+
 			// nothing to do
-			if( Is_Float_Equal( step_size_y, 0.0f ) )
+			if( Is_Float_Equal( step_size, 0.0f ) )
 			{
-				move_y_valid = 0;
+				move_valid = 0;
 				continue;
 			}
 
 			// collision check
-			cObjectCollisionType *col_list_temp = Collision_Check_Relative( 0.0f, step_size_y, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list );
-
-			bool collision_found = 0;
+			cObjectCollisionType *col_list_temp = Collision_Check_Relative( check_x ? step_size : 0.0f, check_x ? 0.0f : step_size, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list );
 
-			// stop on everything
-			if( stop_on_internal )
-			{
-				if( col_list_temp->size() )
-				{
-					collision_found = 1;
-				}
-			}
 			// stop only on blocking
-			else
+			const bool collision_found = col_list_temp->Is_Included( COL_VTYPE_BLOCKING );
+
+			// remove internal collision from further checks
+			if( !collision_found )
 			{
-				if( col_list_temp->Is_Included( COL_VTYPE_BLOCKING ) )
-				{
-					collision_found = 1;
-				}
-				// remove internal collision from further checks
-				else if( col_list_temp->objects.size() )
+				for( cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr )
 				{
-					for( cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr )
+					cObjectCollision *col = (*itr);
+
+					if( col->m_valid_type != COL_VTYPE_INTERNAL )
+					{
+						continue;
+					}
+
+					// find in sprite list
+					cSprite_List::iterator sprite_itr = std::find( sprite_list.begin(), sprite_list.end(), col->m_obj );
+
+					// not found
+					if( sprite_itr == sprite_list.end() )
 					{
-						cObjectCollision *col = (*itr);
-
-						if( col->m_valid_type != COL_VTYPE_INTERNAL )
-						{
-							continue;
-						}
-
-						// find in sprite list
-						cSprite_List::iterator sprite_itr = std::find( sprite_list.begin(), sprite_list.end(), col->m_obj );
-
-						// not found
-						if( sprite_itr == sprite_list.end() )
-						{
-							continue;
-						}
-
-						sprite_list.erase( sprite_itr );
-
-						// if no objects left
-						if( sprite_list.empty() )
-						{
-							// move to final position
-							m_pos_y = final_pos_y;
-						}
+						continue;
 					}
+
+					sprite_list.erase( sprite_itr );
 				}
 			}
-			
+
 			if( col_list_temp->size() )
 			{
 				col_list->objects.insert( col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end() );
@@ -339,26 +495,28 @@ cObjectCollisionType *cMovingSprite :: Col_Move_in_Steps( float move_x, float mo
 
 			delete col_list_temp;
 
-			if( !collision_found )
+			// collision found
+			if( collision_found )
 			{
-				m_pos_y += step_size_y;
+				step_size = 0.0f;
+				move_valid = 0;
+				continue;
+			}
 
-				if( ( step_size_y > 0.0f && final_pos_y <= m_pos_y ) || ( step_size_y < 0.0f && final_pos_y >= m_pos_y ) )
-				{
-					m_pos_y = final_pos_y;
-					move_y_valid = 0;
-					step_size_y = 0.0f;
-				}
+			float &pos = check_x ? m_pos_x : m_pos_y;
+			const float final_pos = check_x ? final_pos_x : final_pos_y;
 
-				// update collision rects
-				Update_Position_Rect();
-			}
-			// collision found
-			else
+			pos += step_size;
+
+			if( ( step_size > 0.0f && final_pos <= pos ) || ( step_size < 0.0f && final_pos >= pos ) )
 			{
-				step_size_y = 0.0f;
-				move_y_valid = 0;
+				pos = final_pos;
+				move_valid = 0;
+				step_size = 0.0f;
 			}
+
+			// update collision rects
+			Update_Position_Rect();
 		}
 	}
 
@@ -419,7 +577,7 @@ void cMovingSprite :: Col_Move( float move_x, float move_y, bool real /* = 0 */,
 		float step_size_x = move_x;
 		float step_size_y = move_y;
 
-		// check if object collision rect is smaller as the position check size
+		// check if object collision rect is smaller as the step size
 		if( step_size_x > m_col_rect.m_w )
 		{
 			step_size_x = m_col_rect.m_w;
@@ -438,44 +596,30 @@ void cMovingSprite :: Col_Move( float move_x, float move_y, bool real /* = 0 */,
 			step_size_y = -m_col_rect.m_h;
 		}
 
-		float final_pos_x = m_pos_x + move_x;
-		float final_pos_y = m_pos_y + move_y;
-
-		// move in big steps
-		cObjectCollisionType *col_list = Col_Move_in_Steps( move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list, 1 );
-
-		// if a collision is found enter pixel checking
-		if( col_list && col_list->size() )
+		// pixel steps
+		if( step_size_x < -1.0f )
 		{
-			// change to pixel checking
-			if( step_size_x < -1.0f )
-			{
-				step_size_x = -1.0f;
-			}
-			else if( step_size_x > 1.0f )
-			{
-				step_size_x = 1.0f;
-			}
-
-			if( step_size_y < -1.0f )
-			{
-				step_size_y = -1.0f;
-			}
-			else if( step_size_y > 1.0f )
-			{
-				step_size_y = 1.0f;
-			}
-
-			delete col_list;
-			col_list = Col_Move_in_Steps( move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list );
-
-			Add_Collisions( col_list, 1 );
+			step_size_x = -1.0f;
+		}
+		else if( step_size_x > 1.0f )
+		{
+			step_size_x = 1.0f;
 		}
 
-		if( col_list )
+		if( step_size_y < -1.0f )
 		{
-			delete col_list;
+			step_size_y = -1.0f;
 		}
+		else if( step_size_y > 1.0f )
+		{
+			step_size_y = 1.0f;
+		}
+
+		// move to the first blocking contact
+		cObjectCollisionType *col_list = Col_Move_Swept( move_x, move_y, step_size_x, step_size_y, sprite_list );
+
+		Add_Collisions( col_list, 1 );
+		delete col_list;
 	}
 	// don't check for collisions
 	else
@@ -696,10 +840,14 @@ cObjectCollisionType *cMovingSprite :: Collision_Check( const GL_rect &new_rect,
 		return col_list;
 	}
 
+	// objects near the rect if no object list is given
+	cSprite_List collidable_objects;
+
 	// if no object list is given get all objects available
 	if( !objects )
 	{
-		objects = &m_sprite_manager->objects;
+		m_sprite_manager->Get_Collidable_Objects( collidable_objects, new_rect, this );
+		objects = &collidable_objects;
 
 		// Player
 		if( m_type != TYPE_PLAYER && new_rect.Intersects( pActive_Player->m_col_rect ) )
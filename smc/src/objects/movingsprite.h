@@ -296,12 +296,20 @@ public:
 	float m_freeze_counter;
 
 private:
-	/* moves in steps and checks in both directions simultaneous
+	/* moves directly to the earliest contact of the swept collision rect and checks it in both directions
+	 * internal collisions are passed and the move continues until both directions are blocked or finished
+	 * a valid contact which is not reached by the check is retried one step nearer
+	 * if the iterations run out the rest is moved with Col_Move_in_Steps
 	 * returns the found collisions
+	 * step_size_x/y : distance to the contact used for the collision check
 	 * sprite_list : objects to check
-	 * stop_on_internal : if set stops moving if internal collision was found
 	*/
-	cObjectCollisionType *Col_Move_in_Steps( float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal = 0 );
+	cObjectCollisionType *Col_Move_Swept( float move_x, float move_y, float step_size_x, float step_size_y, cSprite_List sprite_list );
+	/* moves in steps checking both directions until blocked or the final position is reached
+	 * internal collisions are passed and removed from the sprite list
+	 * returns the found collisions
+	*/
+	cObjectCollisionType *Col_Move_in_Steps( float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List &sprite_list );
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -21,8 +21,6 @@
 #include "../user/savegame.h"
 #include "../level/level.h"
 #include "../core/sprite_manager.h"
-#include "../enemies/static.h"
-#include "../objects/moving_platform.h"
 // CEGUI
 #include "CEGUIWindowManager.h"
 #include "elements/CEGUIEditbox.h"
@@ -38,6 +36,7 @@ namespace SMC
 cPath_State :: cPath_State( cSprite_Manager *sprite_manager )
 {
 	m_sprite_manager = sprite_manager;
+	m_path_registry = NULL;
 	m_path = NULL;
 	m_forward = 1;
 	m_pos_x = 0;
@@ -54,6 +53,11 @@ cPath_State :: ~cPath_State( void )
 	{
 		m_path->Remove_Link( this );
 	}
+
+	if( m_path_registry )
+	{
+		m_path_registry->Remove_Path_State( this );
+	}
 }
 
 void cPath_State :: Load_From_Savegame( cSave_Level_Object *save_object )
@@ -101,6 +105,17 @@ void cPath_State :: Save_To_Savegame( cSave_Level_Object *save_object )
 void cPath_State :: Set_Sprite_Manager( cSprite_Manager *sprite_manager )
 {
 	m_sprite_manager = sprite_manager;
+
+	// move to the new registry
+	if( m_path_registry )
+	{
+		m_path_registry->Remove_Path_State( this );
+
+		if( m_sprite_manager )
+		{
+			m_sprite_manager->m_path_registry->Add_Path_State( this );
+		}
+	}
 }
 
 void cPath_State :: Draw( void )
@@ -115,31 +130,12 @@ void cPath_State :: Draw( void )
 
 cPath *cPath_State :: Get_Path_Object( const std::string &identifier )
 {
-	if( identifier.empty() )
+	if( identifier.empty() || !m_sprite_manager )
 	{
 		return NULL;
 	}
 
-	// Search for path
-	for( cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr )
-	{
-		cSprite *obj = (*itr);
-
-		if( obj->m_type != TYPE_PATH || obj->m_auto_destroy )
-		{
-			continue;
-		}
-
-		cPath *path = static_cast<cPath *>(obj);
-
-		// found
-		if( path->m_identifier.compare( identifier ) == 0 )
-		{
-			return path;
-		}
-	}
-
-	return NULL;
+	return m_sprite_manager->m_path_registry->Get_Path( identifier );
 }
 
 void cPath_State :: Set_Path_Identifier( const std::string &path )
@@ -150,8 +146,20 @@ void cPath_State :: Set_Path_Identifier( const std::string &path )
 		m_path->Remove_Link( this );
 	}
 
+	if( m_path_registry )
+	{
+		m_path_registry->Remove_Path_State( this );
+	}
+
 	// set path
 	m_path_identifier = path;
+
+	// register to get linked if a path gets this identifier
+	if( !m_path_identifier.empty() && m_sprite_manager )
+	{
+		m_sprite_manager->m_path_registry->Add_Path_State( this );
+	}
+
 	m_path = Get_Path_Object( m_path_identifier );
 
 	// not found
@@ -474,6 +482,11 @@ cPath :: cPath( CEGUI::XMLAttributes &attributes, cSprite_Manager *sprite_manage
 cPath :: ~cPath( void )
 {
 	Remove_Links();
+
+	if( m_path_registry )
+	{
+		m_path_registry->Remove_Path( this );
+	}
 }
 
 void cPath :: Init( void )
@@ -494,6 +507,7 @@ void cPath :: Init( void )
 	m_start_rect.m_h = m_rect.m_h;
 
 	m_rewind = 0;
+	m_path_registry = NULL;
 	m_editor_color = Color( static_cast<Uint8>(100), 150, 200, 128 );
 	m_editor_selected_segment = 0;
 }
@@ -594,52 +608,42 @@ cSave_Level_Object *cPath :: Save_To_Savegame( void )
 
 void cPath :: Set_Identifier( const std::string &identifier )
 {
+	cPath_Registry *path_registry = m_path_registry;
+
+	if( path_registry )
+	{
+		path_registry->Remove_Path( this );
+	}
+
 	m_identifier = identifier;
 
 	// remove linked objects
 	Remove_Links();
-	
+
+	// not in a sprite manager
+	if( !path_registry )
+	{
+		return;
+	}
+
+	path_registry->Add_Path( this );
+
 	if( m_identifier.empty() )
 	{
 		return;
 	}
 
-	/* search for linked objects
+	/* link the path states using the identifier
 	 * needed to update the links
 	*/
-	for( cSprite_List::iterator itr = pActive_Level->m_sprite_manager->objects.begin(); itr != pActive_Level->m_sprite_manager->objects.end(); ++itr )
-	{
-		cSprite *obj = (*itr);
-
-		if( obj->m_auto_destroy )
-		{
-			continue;
-		}
+	vector<cPath_State *> path_states;
+	path_registry->Get_Path_States( path_states, m_identifier );
 
-		if( obj->m_type == TYPE_STATIC_ENEMY )
-		{
-			cStaticEnemy *static_enemy = static_cast<cStaticEnemy *>(obj);
-
-			// found
-			if( static_enemy->m_path_state.m_path_identifier.compare( m_identifier ) == 0 )
-			{
-				// link to me
-				static_enemy->Init_Links();
-				//static_enemy->m_path_state.Set_Path_Identifier( m_identifier );
-			}
-		}
-		else if( obj->m_type == TYPE_MOVING_PLATFORM )
-		{
-			cMoving_Platform *moving_platform = static_cast<cMoving_Platform *>(obj);
+	for( vector<cPath_State *>::iterator itr = path_states.begin(); itr != path_states.end(); ++itr )
+	{
+		cPath_State *path_state = (*itr);
 
-			// found
-			if( moving_platform->m_path_state.m_path_identifier.compare( m_identifier ) == 0 )
-			{
-				// link to me
-				moving_platform->Init_Links();
-				//moving_platform->m_path_state.Set_Path_Identifier( m_identifier );
-			}
-		}
+		path_state->Set_Path_Identifier( path_state->m_path_identifier );
 	}
 }
 
@@ -670,6 +674,22 @@ void cPath :: Set_Rewind( bool rewind )
 	}
 }
 
+void cPath :: Destroy( void )
+{
+	if( m_auto_destroy )
+	{
+		return;
+	}
+
+	// destroyed paths can not be linked
+	if( m_path_registry )
+	{
+		m_path_registry->Remove_Path( this );
+	}
+
+	cSprite::Destroy();
+}
+
 void cPath :: Create_Link( cPath_State *path_state )
 {
 	if( !path_state )
@@ -706,6 +726,8 @@ void cPath :: Remove_Links( void )
 
 		obj->Path_Destroyed_Event();
 	}
+
+	m_linked_path_states.clear();
 }
 
 void cPath :: Update( void )
@@ -1082,6 +1104,137 @@ void cPath :: Editor_Segment_Pos_Changed( void )
 	}
 }
 
+/* *** *** *** *** *** *** *** Path registry class *** *** *** *** *** *** *** *** *** *** */
+
+cPath_Registry :: cPath_Registry( void )
+{
+
+}
+
+cPath_Registry :: ~cPath_Registry( void )
+{
+	// registered objects could be deleted after the registry
+	for( PathMap::iterator itr = m_paths.begin(); itr != m_paths.end(); ++itr )
+	{
+		for( RegisteredPathList::iterator path_itr = itr->second.begin(); path_itr != itr->second.end(); ++path_itr )
+		{
+			(*path_itr)->m_path_registry = NULL;
+		}
+	}
+
+	for( PathStateMap::iterator itr = m_path_states.begin(); itr != m_path_states.end(); ++itr )
+	{
+		for( RegisteredPathStateList::iterator state_itr = itr->second.begin(); state_itr != itr->second.end(); ++state_itr )
+		{
+			(*state_itr)->m_path_registry = NULL;
+		}
+	}
+}
+
+void cPath_Registry :: Add_Path( cPath *path )
+{
+	if( path->m_path_registry )
+	{
+		path->m_path_registry->Remove_Path( path );
+	}
+
+	m_paths[path->m_identifier].push_back( path );
+	path->m_path_registry = this;
+}
+
+void cPath_Registry :: Remove_Path( cPath *path )
+{
+	if( path->m_path_registry != this )
+	{
+		return;
+	}
+
+	path->m_path_registry = NULL;
+
+	PathMap::iterator itr = m_paths.find( path->m_identifier );
+
+	if( itr == m_paths.end() )
+	{
+		return;
+	}
+
+	RegisteredPathList::iterator path_itr = std::find( itr->second.begin(), itr->second.end(), path );
+
+	if( path_itr != itr->second.end() )
+	{
+		itr->second.erase( path_itr );
+	}
+
+	if( itr->second.empty() )
+	{
+		m_paths.erase( itr );
+	}
+}
+
+cPath *cPath_Registry :: Get_Path( const std::string &identifier ) const
+{
+	PathMap::const_iterator itr = m_paths.find( identifier );
+
+	if( itr == m_paths.end() )
+	{
+		return NULL;
+	}
+
+	return itr->second.front();
+}
+
+void cPath_Registry :: Add_Path_State( cPath_State *path_state )
+{
+	if( path_state->m_path_registry )
+	{
+		path_state->m_path_registry->Remove_Path_State( path_state );
+	}
+
+	m_path_states[path_state->m_path_identifier].push_back( path_state );
+	path_state->m_path_registry = this;
+}
+
+void cPath_Registry :: Remove_Path_State( cPath_State *path_state )
+{
+	if( path_state->m_path_registry != this )
+	{
+		return;
+	}
+
+	path_state->m_path_registry = NULL;
+
+	PathStateMap::iterator itr = m_path_states.find( path_state->m_path_identifier );
+
+	if( itr == m_path_states.end() )
+	{
+		return;
+	}
+
+	RegisteredPathStateList::iterator state_itr = std::find( itr->second.begin(), itr->second.end(), path_state );
+
+	if( state_itr != itr->second.end() )
+	{
+		itr->second.erase( state_itr );
+	}
+
+	if( itr->second.empty() )
+	{
+		m_path_states.erase( itr );
+	}
+}
+
+void cPath_Registry :: Get_Path_States( vector<cPath_State *> &path_states, const std::string &identifier ) const
+{
+	PathStateMap::const_iterator itr = m_path_states.find( identifier );
+
+	if( itr == m_path_states.end() )
+	{
+		return;
+	}
+
+	path_states.insert( path_states.end(), itr->second.begin(), itr->second.end() );
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace SMC
@@ -18,6 +18,7 @@
 
 #include "../core/global_basic.h"
 #include "../objects/sprite.h"
+#include <boost/unordered_map.hpp>
 
 namespace SMC
 {
@@ -26,6 +27,7 @@ namespace SMC
 
 // forward declaration
 class cPath;
+class cPath_Registry;
 
 class cPath_State
 {
@@ -75,6 +77,8 @@ public:
 
 	// the parent sprite manager
 	cSprite_Manager *m_sprite_manager;
+	// registry the path identifier is registered in
+	cPath_Registry *m_path_registry;
 
 	// parent path identifier
 	std::string m_path_identifier;
@@ -168,6 +172,9 @@ public:
 	// Set if we move from the beginning again if reached the end instead of turning around
 	void Set_Rewind( bool rewind );
 
+	// Set this sprite to destroyed and remove it from the path registry
+	virtual void Destroy( void );
+
 	// Add a link to a path state
 	void Create_Link( cPath_State *path_state );
 	// Remove a link to a path state
@@ -225,6 +232,9 @@ public:
 	typedef vector<cPath_State *> PathStateList;
 	PathStateList m_linked_path_states;
 
+	// registry the identifier is registered in
+	cPath_Registry *m_path_registry;
+
 private:
 	// editor color
 	Color m_editor_color;
@@ -232,6 +242,45 @@ private:
 	unsigned int m_editor_selected_segment;
 };
 
+/* *** *** *** *** *** *** *** Path registry class *** *** *** *** *** *** *** *** *** *** */
+
+/* Identifier index of the paths and path states of a sprite manager
+ * paths are registered while they are in the sprite manager and not destroyed
+ * path states are registered with their path identifier even if the path does not exist
+*/
+class cPath_Registry
+{
+public:
+	cPath_Registry( void );
+	~cPath_Registry( void );
+
+	// Register the path with its identifier
+	void Add_Path( cPath *path );
+	// Unregister the path
+	void Remove_Path( cPath *path );
+	/* Return the first registered path with the given identifier
+	 * if not found returns NULL
+	*/
+	cPath *Get_Path( const std::string &identifier ) const;
+
+	// Register the path state with its path identifier
+	void Add_Path_State( cPath_State *path_state );
+	// Unregister the path state
+	void Remove_Path_State( cPath_State *path_state );
+	// Add the path states registered with the given path identifier
+	void Get_Path_States( vector<cPath_State *> &path_states, const std::string &identifier ) const;
+
+private:
+	typedef vector<cPath *> RegisteredPathList;
+	typedef boost::unordered_map<std::string, RegisteredPathList> PathMap;
+	typedef vector<cPath_State *> RegisteredPathStateList;
+	typedef boost::unordered_map<std::string, RegisteredPathStateList> PathStateMap;
+
+	// paths by identifier in registration order
+	PathMap m_paths;
+	// path states by path identifier
+	PathStateMap m_path_states;
+};
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
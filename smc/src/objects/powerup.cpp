@@ -634,7 +634,7 @@ void cFirePlant :: Update( void )
 		// if no direction image set
 		if( m_curr_img == 0 )
 		{
-			Set_Image_Num( 1 + ( rand() % 2 ), 0, 0 );
+			Set_Image_Num( 1 + Get_Random_Int( 2 ), 0, 0 );
 		}
 		// direction image is set
 		else
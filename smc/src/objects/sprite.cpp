@@ -72,6 +72,12 @@ void cCollidingSprite :: Handle_Collisions( void )
 	}
 
 	col_list.clear();
+
+	// keep the list memory if no new collisions were added while handling
+	if( m_collisions.empty() )
+	{
+		m_collisions.swap( col_list );
+	}
 }
 
 cObjectCollision *cCollidingSprite :: Create_Collision_Object( const cSprite *base, cSprite *col, Col_Valid_Type valid_type ) const
@@ -349,6 +355,7 @@ void cSprite :: Init( void )
 	m_start_image = NULL;
 	m_image = NULL;
 	m_auto_destroy = 0;
+	m_hot_index = static_cast<unsigned int>(-1);
 	m_delete_image = 0;
 	m_shadow_pos = 0.0f;
 	m_shadow_color = black;
@@ -401,22 +408,54 @@ void cSprite :: Init( void )
 cSprite *cSprite :: Copy( void ) const
 {
 	cSprite *basic_sprite = new cSprite( m_sprite_manager );
-	basic_sprite->Set_Image( m_start_image, 1 );
-	basic_sprite->Set_Pos( m_start_pos_x, m_start_pos_y, 1 );
-	basic_sprite->m_type = m_type;
-	basic_sprite->m_sprite_array = m_sprite_array;
-	basic_sprite->Set_Massive_Type( m_massive_type );
-	basic_sprite->m_can_be_ground = m_can_be_ground;
-	basic_sprite->Set_Rotation_Affects_Rect( m_rotation_affects_rect );
-	basic_sprite->Set_Scale_Affects_Rect( m_scale_affects_rect );
-	basic_sprite->Set_Scale_Directions( m_scale_up, m_scale_down, m_scale_left, m_scale_right );
-	basic_sprite->Set_Ignore_Camera( m_no_camera );
-	basic_sprite->Set_Shadow_Pos( m_shadow_pos );
-	basic_sprite->Set_Shadow_Color( m_shadow_color );
-	basic_sprite->Set_Spawned( m_spawned );
+	basic_sprite->Clone_Prototype( this );
 	return basic_sprite;
 }
 
+void cSprite :: Clone_Prototype( const cSprite *prototype )
+{
+	// start image with its unscaled and unrotated rects
+	cGL_Surface *image = prototype->m_start_image;
+
+	m_image = image;
+	m_start_image = image;
+	m_delete_image = 0;
+
+	if( image )
+	{
+		m_col_pos = image->m_col_pos;
+		m_col_rect.m_w = image->m_col_w;
+		m_col_rect.m_h = image->m_col_h;
+		m_rect.m_w = image->m_w;
+		m_rect.m_h = image->m_h;
+		m_start_rect.m_w = image->m_w;
+		m_start_rect.m_h = image->m_h;
+		m_name = image->m_name;
+		m_editor_tags = image->m_editor_tags;
+	}
+
+	m_type = prototype->m_type;
+	m_sprite_array = prototype->m_sprite_array;
+	m_massive_type = prototype->m_massive_type;
+	/* the new sprite is not in the sprite manager yet
+	 * so it only gets the massive type start z position which is raised when it is added
+	*/
+	m_pos_z = Get_Massive_Type_Pos_Z();
+	m_can_be_ground = prototype->m_can_be_ground;
+	m_rotation_affects_rect = prototype->m_rotation_affects_rect;
+	m_scale_affects_rect = prototype->m_scale_affects_rect;
+	m_scale_up = prototype->m_scale_up;
+	m_scale_down = prototype->m_scale_down;
+	m_scale_left = prototype->m_scale_left;
+	m_scale_right = prototype->m_scale_right;
+	m_no_camera = prototype->m_no_camera;
+	m_shadow_pos = prototype->m_shadow_pos;
+	m_shadow_color = prototype->m_shadow_color;
+	Set_Spawned( prototype->m_spawned );
+
+	Set_Pos( prototype->m_start_pos_x, prototype->m_start_pos_y, 1 );
+}
+
 void cSprite :: Load_From_XML( CEGUI::XMLAttributes &attributes )
 {
 	// position
@@ -598,6 +637,8 @@ void cSprite :: Set_Sprite_Type( SpriteType type )
 		Set_Massive_Type( MASS_CLIMBABLE );
 		m_can_be_ground = 0;
 	}
+
+	Update_Hot_Data();
 }
 
 std::string cSprite :: Get_Sprite_Type_String( void ) const
@@ -662,6 +703,7 @@ void cSprite :: Set_Ignore_Camera( bool enable /* = 0 */ )
 	m_no_camera = enable;
 
 	Update_Valid_Draw();
+	Update_Hot_Data();
 }
 
 void cSprite :: Set_Pos( float x, float y, bool new_startpos /* = 0 */ )
@@ -810,6 +852,7 @@ void cSprite :: Set_Rotation_Z( float rot, bool new_start_rot /* = 0 */ )
 	if( m_rotation_affects_rect )
 	{
 		Update_Rect_Rotation_Z();
+		Update_Hot_Data();
 	}
 }
 void cSprite :: Set_Scale_X( const float scale, const bool new_startscale /* = 0 */ )
@@ -840,6 +883,8 @@ void cSprite :: Set_Scale_X( const float scale, const bool new_startscale /* = 0
 	{
 		m_start_scale_x = m_scale_x;
 	}
+
+	Update_Hot_Data();
 }
 
 void cSprite :: Set_Scale_Y( const float scale, const bool new_startscale /* = 0 */ )
@@ -870,6 +915,8 @@ void cSprite :: Set_Scale_Y( const float scale, const bool new_startscale /* = 0
 	{
 		m_start_scale_y = m_scale_y;
 	}
+
+	Update_Hot_Data();
 }
 void cSprite :: Set_On_Top( const cSprite *sprite, bool optimize_hor_pos /* = 1 */ )
 {
@@ -931,6 +978,15 @@ void cSprite :: Update_Position_Rect( void )
 	}
 
 	Update_Valid_Draw();
+	Update_Hot_Data();
+}
+
+void cSprite :: Update_Hot_Data( void ) const
+{
+	if( m_sprite_manager )
+	{
+		m_sprite_manager->Update_Hot_Data( this );
+	}
 }
 
 void cSprite :: Update_Valid_Draw( void )
@@ -1286,28 +1342,35 @@ void cSprite :: Set_Massive_Type( MassiveType type )
 	m_massive_type = type;
 
 	// set massive-type z position
+	m_pos_z = Get_Massive_Type_Pos_Z();
+
+	// make it the latest sprite
+	m_sprite_manager->Move_To_Back( this );
+	Update_Hot_Data();
+}
+
+float cSprite :: Get_Massive_Type_Pos_Z( void ) const
+{
 	if( m_massive_type == MASS_MASSIVE )
 	{
-		m_pos_z = m_pos_z_massive_start;
+		return m_pos_z_massive_start;
 	}
 	else if( m_massive_type == MASS_PASSIVE )
 	{
 		if( m_type == TYPE_FRONT_PASSIVE )
 		{
-			m_pos_z = m_pos_z_front_passive_start;
-		}
-		else
-		{
-			m_pos_z = m_pos_z_passive_start;
+			return m_pos_z_front_passive_start;
 		}
+
+		return m_pos_z_passive_start;
 	}
 	else if( m_massive_type == MASS_CLIMBABLE || m_massive_type == MASS_HALFMASSIVE )
 	{
-		m_pos_z = m_pos_z_halfmassive_start;
+		return m_pos_z_halfmassive_start;
 	}
 
-	// make it the latest sprite
-	m_sprite_manager->Move_To_Back( this );
+	// unchanged
+	return m_pos_z;
 }
 
 bool cSprite :: Is_On_Top( const cSprite *obj ) const
@@ -1453,6 +1516,7 @@ void cSprite :: Destroy( void )
 	m_valid_draw = 0;
 	m_valid_update = 0;
 	Set_Image( NULL, 1 );
+	Update_Hot_Data();
 }
 
 void cSprite :: Editor_Add( const CEGUI::String &name, const CEGUI::String &tooltip, CEGUI::Window *window_setting, float obj_width, float obj_height /* = 28 */, bool advance_row /* = 1 */ )
@@ -122,6 +122,10 @@ public:
 	virtual void Init_Links( void ) {};
 	// copy this sprite
 	virtual cSprite *Copy( void ) const;
+	/* Copy the resolved start state of the prototype in one step
+	 * start image, rects, type, collision and drawing settings are taken over without running the setters
+	*/
+	void Clone_Prototype( const cSprite *prototype );
 
 	// load from stream
 	virtual void Load_From_XML( CEGUI::XMLAttributes &attributes );
@@ -343,6 +347,12 @@ public:
 
 	// Update the position rect values
 	void Update_Position_Rect( void );
+	// Update the collision data copy in the sprite manager
+	void Update_Hot_Data( void ) const;
+	/* update which only reads other objects and only changes this object
+	 * runs for all objects in parallel before Update
+	*/
+	virtual void Update_Parallel( void ) {};
 	// default update
 	virtual void Update( void ) {};
 	/* late update
@@ -377,6 +387,8 @@ public:
 	 * should be called after setting the new array
 	*/
 	virtual void Set_Massive_Type( MassiveType type );
+	// Return the start z position of the massive type
+	float Get_Massive_Type_Pos_Z( void ) const;
 
 	// Check if this sprite is on top of the given object
 	bool Is_On_Top( const cSprite *obj ) const;
@@ -534,6 +546,10 @@ public:
 	bool m_valid_draw;
 	// if updating is valid
 	bool m_valid_update;
+	/* collision data index in the sprite manager
+	 * only valid while the sprite manager has the same sprite at this index
+	*/
+	unsigned int m_hot_index;
 
 	// editor active window list
 	typedef vector<cEditor_Object_Settings_Item *> Editor_Object_Settings_List;
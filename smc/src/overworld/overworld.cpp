@@ -30,10 +30,15 @@
 #include "../core/i18n.h"
 #include "../core/filesystem/filesystem.h"
 #include "../core/filesystem/resource_manager.h"
+#include "../core/math/line.h"
 // CEGUI
 #include "CEGUIXMLParser.h"
 #include "CEGUIXMLAttributes.h"
 #include "CEGUIExceptions.h"
+// std
+#include <queue>
+#include <functional>
+#include <algorithm>
 
 namespace SMC
 {
@@ -94,6 +99,8 @@ void cOverworld_description :: Save( void )
 		return;
 	}
 
+	pResource_Manager->Set_Indexed_File( filename, 1 );
+
 	CEGUI::XMLSerializer stream( file );
 
 	// begin 
@@ -172,6 +179,7 @@ void cOverworld_description :: handle_world( const CEGUI::XMLAttributes &attribu
 /* *** *** *** *** *** *** *** *** cOverworld *** *** *** *** *** *** *** *** *** */
 
 cOverworld :: cOverworld( void )
+: m_waypoint_rects( 128.0f )
 {
 	m_sprite_manager = new cWorld_Sprite_Manager( this );
 	m_animation_manager = new cAnimation_Manager();
@@ -193,6 +201,8 @@ cOverworld :: cOverworld( void )
 
 	m_player_start_waypoint = 0;
 	m_player_moving_state = STA_STAY;
+
+	m_waypoint_index_valid = 0;
 }
 
 cOverworld :: ~cOverworld( void )
@@ -295,6 +305,7 @@ void cOverworld :: Unload( void )
 	m_sprite_manager->Delete_All();
 	// Waypoints
 	m_waypoints.clear();
+	Clear_Waypoint_Index();
 	// Layer
 	m_layer->Delete_All();
 	// animations
@@ -333,6 +344,8 @@ void cOverworld :: Save( void )
 		return;
 	}
 
+	pResource_Manager->Set_Indexed_File( filename, 1 );
+
 	CEGUI::XMLSerializer stream( file );
 
 
@@ -769,6 +782,17 @@ bool cOverworld :: Mouse_Down( Uint8 button )
 		// processed by the editor
 		return 1;
 	}
+	// travel to the clicked waypoint
+	else if( button == SDL_BUTTON_LEFT && !editor_world_enabled && !pOverworld_Manager->m_camera_mode )
+	{
+		const int waypoint_num = Get_Waypoint_Collision( GL_rect( pMouseCursor->m_x + pActive_Camera->m_x, pMouseCursor->m_y + pActive_Camera->m_y, 1, 1 ) );
+
+		if( waypoint_num < 0 || !m_waypoints[waypoint_num]->m_access || !pOverworld_Player->Start_Travel( waypoint_num ) )
+		{
+			// not processed
+			return 0;
+		}
+	}
 	else
 	{
 		// not processed
@@ -861,6 +885,18 @@ void cOverworld :: Set_Progress( unsigned int normal_level, bool force /* = 1 */
 
 cWaypoint *cOverworld :: Get_Waypoint( const std::string &name )
 {
+	if( Update_Waypoint_Index() )
+	{
+		WaypointNameMap::const_iterator itr = m_waypoint_names.find( name );
+
+		if( itr == m_waypoint_names.end() )
+		{
+			return NULL;
+		}
+
+		return m_waypoints[itr->second];
+	}
+
 	for( WaypointList::iterator itr = m_waypoints.begin(); itr != m_waypoints.end(); ++itr )
 	{
 		cWaypoint *obj = (*itr);
@@ -900,6 +936,18 @@ int cOverworld :: Get_Level_Waypoint_Num( std::string level_name )
 
 int cOverworld :: Get_Waypoint_Num( const std::string &name )
 {
+	if( Update_Waypoint_Index() )
+	{
+		WaypointNameMap::const_iterator itr = m_waypoint_names.find( name );
+
+		if( itr == m_waypoint_names.end() )
+		{
+			return -1;
+		}
+
+		return itr->second;
+	}
+
 	int count = 0;
 
 	// search waypoint
@@ -920,15 +968,32 @@ int cOverworld :: Get_Waypoint_Num( const std::string &name )
 	return -1;
 }
 
-int cOverworld :: Get_Waypoint_Collision( const GL_rect &rect_2 )
+int cOverworld :: Get_Waypoint_Collision( const GL_rect &rect_2, int ignore_waypoint /* = -1 */ )
 {
+	if( Update_Waypoint_Index() )
+	{
+		vector<unsigned int> waypoints;
+		m_waypoint_rects.Get_Objects( waypoints, rect_2 );
+
+		// waypoints are returned in array order
+		for( vector<unsigned int>::const_iterator itr = waypoints.begin(); itr != waypoints.end(); ++itr )
+		{
+			if( static_cast<int>(*itr) != ignore_waypoint && rect_2.Intersects( m_waypoints[*itr]->m_rect ) )
+			{
+				return *itr;
+			}
+		}
+
+		return -1;
+	}
+
 	int count = 0;
 
 	for( WaypointList::iterator itr = m_waypoints.begin(); itr != m_waypoints.end(); ++itr )
 	{
 		cWaypoint *obj = (*itr);
 
-		if( rect_2.Intersects( obj->m_rect ) )
+		if( count != ignore_waypoint && rect_2.Intersects( obj->m_rect ) )
 		{
 			return count;
 		}
@@ -1067,6 +1132,258 @@ void cOverworld :: Reset_Waypoints( void )
 	}
 }
 
+const WaypointLinkList *cOverworld :: Get_Waypoint_Links( unsigned int num )
+{
+	if( num >= m_waypoints.size() || !Update_Waypoint_Index() )
+	{
+		return NULL;
+	}
+
+	return &m_waypoint_links[num];
+}
+
+bool cOverworld :: Get_Route( unsigned int start_waypoint, unsigned int end_waypoint, WaypointLinkList &route )
+{
+	route.clear();
+
+	if( start_waypoint >= m_waypoints.size() || end_waypoint >= m_waypoints.size() || !Update_Waypoint_Index() )
+	{
+		return 0;
+	}
+
+	// already there
+	if( start_waypoint == end_waypoint )
+	{
+		return 1;
+	}
+
+	const unsigned int count = m_waypoints.size();
+	// walked length from the start
+	vector<float> distance( count, -1.0f );
+	// link used to reach the waypoint
+	vector<const cWaypoint_Link *> previous_link( count, static_cast<const cWaypoint_Link *>(NULL) );
+	vector<int> previous_waypoint( count, -1 );
+
+	typedef std::pair<float, unsigned int> QueueEntry;
+	std::priority_queue<QueueEntry, vector<QueueEntry>, std::greater<QueueEntry> > queue;
+
+	distance[start_waypoint] = 0.0f;
+	queue.push( QueueEntry( 0.0f, start_waypoint ) );
+
+	while( !queue.empty() )
+	{
+		const QueueEntry entry = queue.top();
+		queue.pop();
+
+		// outdated entry
+		if( entry.first > distance[entry.second] )
+		{
+			continue;
+		}
+
+		if( entry.second == end_waypoint )
+		{
+			break;
+		}
+
+		const WaypointLinkList &links = m_waypoint_links[entry.second];
+
+		for( WaypointLinkList::const_iterator itr = links.begin(); itr != links.end(); ++itr )
+		{
+			const cWaypoint_Link &link = (*itr);
+
+			// not accessible
+			if( link.m_forward && !m_waypoints[link.m_waypoint]->m_access )
+			{
+				continue;
+			}
+
+			const float new_distance = entry.first + link.m_length;
+
+			if( distance[link.m_waypoint] >= 0.0f && distance[link.m_waypoint] <= new_distance )
+			{
+				continue;
+			}
+
+			distance[link.m_waypoint] = new_distance;
+			previous_link[link.m_waypoint] = &link;
+			previous_waypoint[link.m_waypoint] = entry.second;
+			queue.push( QueueEntry( new_distance, link.m_waypoint ) );
+		}
+	}
+
+	// not reachable
+	if( distance[end_waypoint] < 0.0f )
+	{
+		return 0;
+	}
+
+	for( int num = end_waypoint; num != static_cast<int>(start_waypoint); num = previous_waypoint[num] )
+	{
+		route.push_back( *previous_link[num] );
+	}
+
+	std::reverse( route.begin(), route.end() );
+	return 1;
+}
+
+void cOverworld :: Clear_Waypoint_Index( void )
+{
+	m_waypoint_index_valid = 0;
+	m_waypoint_names.clear();
+	m_waypoint_rects.Clear();
+	m_waypoint_links.clear();
+}
+
+bool cOverworld :: Update_Waypoint_Index( void )
+{
+	// waypoints and lines can be changed in the editor
+	if( editor_world_enabled )
+	{
+		if( m_waypoint_index_valid )
+		{
+			Clear_Waypoint_Index();
+		}
+
+		return 0;
+	}
+
+	// still valid
+	if( m_waypoint_index_valid )
+	{
+		return 1;
+	}
+
+	Clear_Waypoint_Index();
+
+	for( unsigned int i = 0; i < m_waypoints.size(); i++ )
+	{
+		const cWaypoint *waypoint = m_waypoints[i];
+
+		// the first waypoint with the destination is used
+		m_waypoint_names.insert( WaypointNameMap::value_type( waypoint->m_destination, i ) );
+		m_waypoint_rects.Add( i, waypoint->m_rect );
+	}
+
+	// the graph uses the waypoint collision index
+	m_waypoint_index_valid = 1;
+	m_waypoint_links.resize( m_waypoints.size() );
+
+	// forward links
+	for( unsigned int i = 0; i < m_waypoints.size(); i++ )
+	{
+		const cWaypoint *waypoint = m_waypoints[i];
+
+		if( waypoint->m_direction_forward == DIR_UNDEFINED )
+		{
+			continue;
+		}
+
+		cWaypoint_Link link;
+		link.m_waypoint = Follow_Waypoint_Line( waypoint, waypoint->m_direction_forward, link.m_length );
+
+		if( link.m_waypoint < 0 || link.m_waypoint == static_cast<int>(i) )
+		{
+			continue;
+		}
+
+		link.m_direction = waypoint->m_direction_forward;
+		link.m_forward = 1;
+		m_waypoint_links[i].push_back( link );
+	}
+
+	// backward links walk the lines of the origin waypoint back
+	for( unsigned int i = 0; i < m_waypoints.size(); i++ )
+	{
+		const cWaypoint *waypoint = m_waypoints[i];
+
+		if( waypoint->m_direction_backward == DIR_UNDEFINED )
+		{
+			continue;
+		}
+
+		const cLayer_Line_Point_Start *line = m_layer->Get_Line_Collision_Direction( waypoint->m_rect.m_x + ( waypoint->m_rect.m_w * 0.5f ), waypoint->m_rect.m_y + ( waypoint->m_rect.m_h * 0.5f ), waypoint->m_direction_backward ).m_line;
+
+		if( !line || line->m_origin >= m_waypoints.size() || line->m_origin == i )
+		{
+			continue;
+		}
+
+		cWaypoint_Link link;
+		link.m_waypoint = line->m_origin;
+		link.m_direction = waypoint->m_direction_backward;
+
+		// same length as the forward link
+		const WaypointLinkList &origin_links = m_waypoint_links[line->m_origin];
+
+		for( WaypointLinkList::const_iterator itr = origin_links.begin(); itr != origin_links.end(); ++itr )
+		{
+			if( itr->m_forward && itr->m_waypoint == static_cast<int>(i) )
+			{
+				link.m_length = itr->m_length;
+				break;
+			}
+		}
+
+		// no forward link
+		if( link.m_length <= 0.0f )
+		{
+			const cWaypoint *origin = m_waypoints[line->m_origin];
+			const float diff_x = ( origin->m_rect.m_x + ( origin->m_rect.m_w * 0.5f ) ) - ( waypoint->m_rect.m_x + ( waypoint->m_rect.m_w * 0.5f ) );
+			const float diff_y = ( origin->m_rect.m_y + ( origin->m_rect.m_h * 0.5f ) ) - ( waypoint->m_rect.m_y + ( waypoint->m_rect.m_h * 0.5f ) );
+
+			link.m_length = sqrt( ( diff_x * diff_x ) + ( diff_y * diff_y ) );
+		}
+
+		m_waypoint_links[i].push_back( link );
+	}
+
+	if( game_debug )
+	{
+		unsigned int link_count = 0;
+
+		for( vector<WaypointLinkList>::const_iterator itr = m_waypoint_links.begin(); itr != m_waypoint_links.end(); ++itr )
+		{
+			link_count += itr->size();
+		}
+
+		printf( "Overworld %s waypoint graph : %u waypoints, %u links\n", m_description->m_name.c_str(), static_cast<unsigned int>(m_waypoints.size()), link_count );
+	}
+
+	return 1;
+}
+
+int cOverworld :: Follow_Waypoint_Line( const cWaypoint *waypoint, ObjectDirection dir, float &length )
+{
+	length = 0.0f;
+
+	// line in front of the waypoint center
+	cLayer_Line_Point_Start *line = m_layer->Get_Line_Collision_Direction( waypoint->m_rect.m_x + ( waypoint->m_rect.m_w * 0.5f ), waypoint->m_rect.m_y + ( waypoint->m_rect.m_h * 0.5f ), dir ).m_line;
+
+	// a chain can not be longer than all lines
+	for( unsigned int i = 0; line && i < m_layer->size(); i++ )
+	{
+		const GL_line map_line = line->Get_Line();
+		const float diff_x = map_line.m_x2 - map_line.m_x1;
+		const float diff_y = map_line.m_y2 - map_line.m_y1;
+
+		length += sqrt( ( diff_x * diff_x ) + ( diff_y * diff_y ) );
+
+		// line ends on a waypoint
+		const int waypoint_num = Get_Waypoint_Collision( line->m_linked_point->m_col_rect );
+
+		if( waypoint_num >= 0 )
+		{
+			return waypoint_num;
+		}
+
+		// continue on the next line
+		line = m_layer->Get_Line_Collision_Start( line->m_linked_point->m_col_rect );
+	}
+
+	return -1;
+}
+
 bool cOverworld :: Is_Loaded( void ) const
 {
 	// if not loaded version is -1
@@ -26,6 +26,7 @@
 // CEGUI
 #include "CEGUIXMLHandler.h"
 #include "CEGUIXMLAttributes.h"
+#include <boost/unordered_map.hpp>
 
 namespace SMC
 {
@@ -156,9 +157,10 @@ public:
 	int Get_Waypoint_Num( const std::string &world_name );
 
 	/* Check if the rect collides with a Waypoint
+	 * ignore_waypoint : waypoint array number which is not checked
 	 * if no collision found returns -1
 	*/
-	int Get_Waypoint_Collision( const GL_rect &rect_2 );
+	int Get_Waypoint_Collision( const GL_rect &rect_2, int ignore_waypoint = -1 );
 	// returns the last accessible Waypoint
 	int Get_Last_Valid_Waypoint( void );
 	// update the Waypoint text
@@ -169,6 +171,21 @@ public:
 	// Resets the Waypoint access to the default
 	void Reset_Waypoints( void );
 
+	/* Return the links from the Waypoint to its neighbour Waypoints
+	 * if the Waypoint graph is not available returns NULL
+	*/
+	const WaypointLinkList *Get_Waypoint_Links( unsigned int num );
+	/* Find the shortest walk from the start to the end Waypoint
+	 * route : receives the links to walk in order
+	 * only accessible Waypoints are walked into the forward direction
+	 * returns false if no route exists
+	*/
+	bool Get_Route( unsigned int start_waypoint, unsigned int end_waypoint, WaypointLinkList &route );
+	/* Invalidate the Waypoint names, rects and graph
+	 * they are rebuilt on the next query outside of the editor
+	*/
+	void Clear_Waypoint_Index( void );
+
 	// Return true if a world is loaded
 	bool Is_Loaded( void ) const;
 
@@ -210,6 +227,15 @@ public:
 	cHudSprite *m_hud_level_name;
 
 private:
+	/* Rebuild the Waypoint index and graph if not valid
+	 * returns false if the Waypoints are edited and the index can not be used
+	*/
+	bool Update_Waypoint_Index( void );
+	/* Follow the layer line chain from the Waypoint into the given direction
+	 * returns the reached Waypoint array number or -1 and sets the line length
+	*/
+	int Follow_Waypoint_Line( const cWaypoint *waypoint, ObjectDirection dir, float &length );
+
 	// XML element start
 	virtual void elementStart( const CEGUI::String &element, const CEGUI::XMLAttributes &attributes );
 	// XML element end
@@ -217,6 +243,16 @@ private:
  
 	// XML element property list
 	CEGUI::XMLAttributes m_xml_attributes;
+
+	typedef boost::unordered_map<std::string, int> WaypointNameMap;
+	// first waypoint array number by destination
+	WaypointNameMap m_waypoint_names;
+	// spatial index of the waypoint array numbers by rect
+	cSpatial_Grid<unsigned int> m_waypoint_rects;
+	// links from every waypoint
+	vector<WaypointLinkList> m_waypoint_links;
+	// if the waypoint index and graph are valid
+	bool m_waypoint_index_valid;
 };
 
 /* Returns a World Object if element name is available else NULL
@@ -67,6 +67,12 @@ void cEditor_World :: Enable( void )
 	editor_world_enabled = 1;
 	pOverworld_Manager->m_draw_layer = 1;
 
+	// line points can be moved in the editor
+	if( m_overworld )
+	{
+		m_overworld->m_layer->Clear_Line_Index();
+	}
+
 	if( Game_Mode == MODE_OVERWORLD )
 	{
 		editor_enabled = 1;
@@ -89,6 +95,12 @@ void cEditor_World :: Disable( bool native_mode /* = 0 */ )
 	pOverworld_Manager->m_draw_layer = 0;
 	pOverworld_Manager->m_camera_mode = 0;
 
+	// line points could have been moved
+	if( m_overworld )
+	{
+		m_overworld->m_layer->Clear_Line_Index();
+	}
+
 	if( Game_Mode == MODE_OVERWORLD )
 	{
 		native_mode = 1;
@@ -123,6 +135,12 @@ bool cEditor_World :: Key_Down( SDLKey key )
 
 void cEditor_World :: Set_Overworld( cOverworld *overworld )
 {
+	// line points of the edited overworld could have been moved
+	if( m_enabled && m_overworld && m_overworld != overworld )
+	{
+		m_overworld->m_layer->Clear_Line_Index();
+	}
+
 	m_overworld = overworld;
 }
 
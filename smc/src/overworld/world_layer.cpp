@@ -19,6 +19,7 @@
 #include "../overworld/overworld.h"
 #include "../core/i18n.h"
 #include "../overworld/world_editor.h"
+#include "../core/filesystem/resource_manager.h"
 // CEGUI
 #include "CEGUIXMLParser.h"
 #include "CEGUIWindowManager.h"
@@ -285,8 +286,10 @@ cLine_collision :: cLine_collision( void )
 /* *** *** *** *** *** *** *** *** Layer *** *** *** *** *** *** *** *** *** */
 
 cLayer :: cLayer( cOverworld *origin )
+: m_line_index( 128.0f )
 {
 	m_overworld = origin;
+	m_line_index_valid = 0;
 }
 
 cLayer :: ~cLayer( void )
@@ -309,6 +312,7 @@ void cLayer :: Add( cLayer_Line_Point_Start *line_point )
 	}
 
 	cObject_Manager<cLayer_Line_Point_Start>::Add( line_point );
+	Clear_Line_Index();
 
 	// check if in sprite manager
 	if( m_overworld->m_sprite_manager->Get_Array_Num( line_point ) == -1 )
@@ -324,6 +328,18 @@ void cLayer :: Add( cLayer_Line_Point_Start *line_point )
 	}
 }
 
+bool cLayer :: Delete( size_t array_num, bool delete_data /* = 1 */ )
+{
+	Clear_Line_Index();
+	return cObject_Manager<cLayer_Line_Point_Start>::Delete( array_num, delete_data );
+}
+
+bool cLayer :: Delete( cLayer_Line_Point_Start *obj, bool delete_data /* = 1 */ )
+{
+	Clear_Line_Index();
+	return cObject_Manager<cLayer_Line_Point_Start>::Delete( obj, delete_data );
+}
+
 void cLayer :: Load( const std::string &filename )
 {
 	Delete_All();
@@ -362,6 +378,8 @@ bool cLayer :: Save( const std::string &filename )
 		return 0;
 	}
 
+	pResource_Manager->Set_Indexed_File( filename, 1 );
+
 	CEGUI::XMLSerializer stream( file );
 
 	// begin layer
@@ -398,10 +416,29 @@ void cLayer :: Delete_All( void )
 {
 	// only clear array
 	objects.clear();
+	Clear_Line_Index();
 }
 
 cLayer_Line_Point_Start *cLayer :: Get_Line_Collision_Start( const GL_rect &line_rect )
 {
+	if( Update_Line_Index() )
+	{
+		vector<unsigned int> lines;
+		m_line_index.Get_Objects( lines, line_rect );
+
+		for( vector<unsigned int>::const_iterator itr = lines.begin(); itr != lines.end(); ++itr )
+		{
+			cLayer_Line_Point_Start *layer_line = objects[*itr];
+
+			if( line_rect.Intersects( layer_line->m_col_rect ) )
+			{
+				return layer_line;
+			}
+		}
+
+		return NULL;
+	}
+
 	for( LayerLineList::iterator itr = objects.begin(); itr != objects.end(); ++itr )
 	{
 		// get pointer
@@ -451,6 +488,49 @@ cLine_collision cLayer :: Get_Line_Collision_Direction( float x, float y, Object
 
 cLine_collision cLayer :: Get_Nearest( float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15 */, int only_origin_id /* = -1 */ ) const
 {
+	if( Update_Line_Index() )
+	{
+		// area of both direction checking lines
+		GL_rect check_rect( x, y, 0, 0 );
+
+		if( dir == DIR_HORIZONTAL )
+		{
+			check_rect.m_x -= check_size;
+			check_rect.m_w = static_cast<float>(check_size * 2);
+		}
+		else // vertical
+		{
+			check_rect.m_y -= check_size;
+			check_rect.m_h = static_cast<float>(check_size * 2);
+		}
+
+		vector<unsigned int> lines;
+		m_line_index.Get_Objects( lines, check_rect );
+
+		// lines are returned in array order
+		for( vector<unsigned int>::const_iterator itr = lines.begin(); itr != lines.end(); ++itr )
+		{
+			cLayer_Line_Point_Start *layer_line = objects[*itr];
+
+			// line is not from waypoint
+			if( only_origin_id >= 0 && only_origin_id != layer_line->m_origin )
+			{
+				continue;
+			}
+
+			cLine_collision col = Get_Nearest_Line( layer_line, *itr, x, y, dir, check_size );
+
+			// found
+			if( col.m_line )
+			{
+				return col;
+			}
+		}
+
+		// none found
+		return cLine_collision();
+	}
+
 	for( LayerLineList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr )
 	{
 		// get pointer
@@ -476,6 +556,55 @@ cLine_collision cLayer :: Get_Nearest( float x, float y, ObjectDirection dir /*
 }
 
 cLine_collision cLayer :: Get_Nearest_Line( cLayer_Line_Point_Start *map_layer_line, float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15  */ ) const
+{
+	return Get_Nearest_Line( map_layer_line, Get_Array_Num( map_layer_line ), x, y, dir, check_size );
+}
+
+void cLayer :: Clear_Line_Index( void )
+{
+	m_line_index_valid = 0;
+	m_line_index.Clear();
+	// the waypoint graph is built from the lines
+	m_overworld->Clear_Waypoint_Index();
+}
+
+bool cLayer :: Update_Line_Index( void ) const
+{
+	// line points can be moved in the editor
+	if( editor_world_enabled )
+	{
+		m_line_index_valid = 0;
+		return 0;
+	}
+
+	// still valid
+	if( m_line_index_valid )
+	{
+		return 1;
+	}
+
+	m_line_index.Clear();
+
+	for( unsigned int i = 0; i < objects.size(); i++ )
+	{
+		const cLayer_Line_Point_Start *layer_line = objects[i];
+		const GL_rect &start_rect = layer_line->m_col_rect;
+		const GL_rect &end_rect = layer_line->m_linked_point->m_col_rect;
+
+		// the area enclosing both points contains the line
+		const float x1 = std::min( start_rect.m_x, end_rect.m_x );
+		const float y1 = std::min( start_rect.m_y, end_rect.m_y );
+		const float x2 = std::max( start_rect.m_x + start_rect.m_w, end_rect.m_x + end_rect.m_w );
+		const float y2 = std::max( start_rect.m_y + start_rect.m_h, end_rect.m_y + end_rect.m_h );
+
+		m_line_index.Add( i, GL_rect( x1, y1, x2 - x1, y2 - y1 ) );
+	}
+
+	m_line_index_valid = 1;
+	return 1;
+}
+
+cLine_collision cLayer :: Get_Nearest_Line( cLayer_Line_Point_Start *map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size ) const
 {
 	GL_line line_1, line_2;
 
@@ -529,7 +658,7 @@ cLine_collision cLayer :: Get_Nearest_Line( cLayer_Line_Point_Start *map_layer_l
 			cLine_collision col = cLine_collision();
 
 			col.m_line = map_layer_line;
-			col.m_line_number = Get_Array_Num( map_layer_line );
+			col.m_line_number = line_number;
 			col.m_difference = csize;
 
 			// found
@@ -542,7 +671,7 @@ cLine_collision cLayer :: Get_Nearest_Line( cLayer_Line_Point_Start *map_layer_l
 			cLine_collision col = cLine_collision();
 
 			col.m_line = map_layer_line;
-			col.m_line_number = Get_Array_Num( map_layer_line );
+			col.m_line_number = line_number;
 			col.m_difference = -csize;
 
 			// found
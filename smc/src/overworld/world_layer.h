@@ -20,6 +20,7 @@
 #include "../objects/movingsprite.h"
 #include "../core/obj_manager.h"
 #include "../overworld/world_waypoint.h"
+#include "../core/spatial_grid.h"
 // CEGUI
 #include "CEGUIXMLHandler.h"
 #include "CEGUIXMLAttributes.h"
@@ -137,6 +138,11 @@ public:
 	// Add a layer line
 	virtual void Add( cLayer_Line_Point_Start *line_point );
 
+	// Delete the layer line from the given array number
+	virtual bool Delete( size_t array_num, bool delete_data = 1 );
+	// Delete the given layer line
+	virtual bool Delete( cLayer_Line_Point_Start *obj, bool delete_data = 1 );
+
 	// Load from file
 	void Load( const std::string &filename );
 
@@ -163,10 +169,28 @@ public:
 	// Return the collision data between the given line and position
 	cLine_collision Get_Nearest_Line( cLayer_Line_Point_Start *map_layer_line, float x, float y, ObjectDirection dir = DIR_HORIZONTAL, unsigned int check_size = 15 ) const;
 
+	/* Invalidate the line index and the overworld waypoint graph
+	 * it is rebuilt on the next collision query outside of the editor
+	 * called on every line change and when the world editor is enabled or disabled
+	*/
+	void Clear_Line_Index( void );
+
 	// parent overworld
 	cOverworld *m_overworld;
 
 private:
+	/* Rebuild the line index if not valid
+	 * returns false if the lines are edited and the index can not be used
+	*/
+	bool Update_Line_Index( void ) const;
+	// Return the collision data between the given line with its array number and position
+	cLine_collision Get_Nearest_Line( cLayer_Line_Point_Start *map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size ) const;
+
+	// spatial index of the line array numbers by the line and point rects
+	mutable cSpatial_Grid<unsigned int> m_line_index;
+	// if the line index is valid
+	mutable bool m_line_index_valid;
+
 	// XML element start
 	virtual void elementStart( const CEGUI::String &element, const CEGUI::XMLAttributes &attributes );
 	// XML element end
@@ -21,6 +21,7 @@
 #include "../overworld/world_editor.h"
 #include "../input/mouse.h"
 #include "../video/animation.h"
+#include "../core/framerate.h"
 // CEGUI
 #include "CEGUIXMLParser.h"
 
@@ -35,6 +36,8 @@ cOverworld_Manager :: cOverworld_Manager( cSprite_Manager *sprite_manager )
 	m_debug_mode = 0;
 	m_draw_layer = 0;
 	m_camera_mode = 0;
+	m_prefetch = 1;
+	m_prefetch_delay = 0.0f;
 
 	m_camera = new cCamera( sprite_manager );
 
@@ -79,6 +82,8 @@ void cOverworld_Manager :: Init( void )
 		Delete_All();
 	}
 
+	m_prefetch_worlds.clear();
+
 	// Load Worlds
 	Load_Dir( pResource_Manager->user_data_dir + USER_WORLD_DIR, 1 );
 	Load_Dir( DATA_DIR "/" GAME_OVERWORLD_DIR );
@@ -121,7 +126,8 @@ void cOverworld_Manager :: Load_Dir( const std::string &dir, bool user_dir /* =
 
 				objects.push_back( overworld );
 
-				overworld->Load();
+				// the world is loaded when entered
+				overworld->m_description->Load();
 			}
 		}
 		catch( const std::exception &ex )
@@ -131,6 +137,95 @@ void cOverworld_Manager :: Load_Dir( const std::string &dir, bool user_dir /* =
 	}
 }
 
+bool cOverworld_Manager :: Load_World( cOverworld *world )
+{
+	if( !world )
+	{
+		return 0;
+	}
+
+	if( world->Is_Loaded() )
+	{
+		return 1;
+	}
+
+	const Uint32 start_ticks = SDL_GetTicks();
+
+	world->Load();
+
+	// failed
+	if( !world->Is_Loaded() )
+	{
+		return 0;
+	}
+
+	if( game_debug )
+	{
+		printf( "Overworld %s loaded in %u ms\n", world->m_description->m_name.c_str(), SDL_GetTicks() - start_ticks );
+	}
+
+	return 1;
+}
+
+void cOverworld_Manager :: Prefetch( const cOverworld *world )
+{
+	m_prefetch_worlds.clear();
+
+	if( !m_prefetch || !world )
+	{
+		return;
+	}
+
+	for( WaypointList::const_iterator itr = world->m_waypoints.begin(); itr != world->m_waypoints.end(); ++itr )
+	{
+		const cWaypoint *waypoint = (*itr);
+
+		if( waypoint->m_waypoint_type != WAYPOINT_WORLD_LINK )
+		{
+			continue;
+		}
+
+		const cOverworld *linked_world = Get( waypoint->Get_Destination() );
+
+		if( !linked_world || linked_world->Is_Loaded() )
+		{
+			continue;
+		}
+
+		m_prefetch_worlds.push_back( linked_world->m_description->m_path );
+	}
+
+	// let the world fade in first
+	m_prefetch_delay = speedfactor_fps * 2.0f;
+}
+
+void cOverworld_Manager :: Update( void )
+{
+	if( m_prefetch_worlds.empty() )
+	{
+		return;
+	}
+
+	if( m_prefetch_delay > 0.0f )
+	{
+		m_prefetch_delay -= pFramerate->m_speed_factor;
+		return;
+	}
+
+	// only while standing on a waypoint
+	if( pOverworld_Player->m_current_waypoint < 0 || editor_world_enabled )
+	{
+		return;
+	}
+
+	const std::string path = m_prefetch_worlds.back();
+	m_prefetch_worlds.pop_back();
+
+	Load_World( Get_from_Path( path ) );
+	// one world at a time
+	m_prefetch_delay = speedfactor_fps * 0.5f;
+}
+
 bool cOverworld_Manager :: Set_Active( const std::string &str ) 
 {
 	return Set_Active( Get( str ) );
@@ -138,7 +233,7 @@ bool cOverworld_Manager :: Set_Active( const std::string &str )
 
 bool cOverworld_Manager :: Set_Active( cOverworld *world )
 {
-	if( !world )
+	if( !Load_World( world ) )
 	{
 		return 0;
 	}
@@ -164,6 +259,8 @@ bool cOverworld_Manager :: Set_Active( cOverworld *world )
 		}
 	}
 
+	Prefetch( world );
+
 	return 1;
 }
 
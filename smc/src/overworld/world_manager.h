@@ -41,13 +41,22 @@ public:
 	*/
 	bool New( std::string name );
 
-	// Load all overworlds
-	// todo : should only load overworld info
+	// Load the description of all overworlds
 	void Init( void );
 	/* Load overworlds from the given directory
+	 * only the description is loaded and the world itself when it is needed
 	 * user_dir : if set overrides game worlds
 	*/
 	void Load_Dir( const std::string &dir, bool user_dir = 0 );
+	/* Load the world if not already loaded
+	 * returns true if loaded
+	*/
+	bool Load_World( cOverworld *world );
+
+	// Queue the worlds linked from the waypoints of the given world for loading
+	void Prefetch( const cOverworld *world );
+	// Load a queued world while the player is standing on a waypoint
+	void Update( void );
 
 	// Set active Overworld from name or path
 	bool Set_Active( const std::string &str );
@@ -74,8 +83,17 @@ public:
 	// map scrolling with the arrow keys
 	bool m_camera_mode;
 
+	// load linked worlds in advance
+	bool m_prefetch;
+
 	// world camera
 	cCamera *m_camera;
+
+private:
+	// paths of the worlds queued for loading
+	vector<std::string> m_prefetch_worlds;
+	// time until queued worlds are loaded
+	float m_prefetch_delay;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
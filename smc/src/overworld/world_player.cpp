@@ -44,6 +44,7 @@ cOverworld_Player :: cOverworld_Player( cSprite_Manager *sprite_manager, cOverwo
 	m_current_line = -2;
 
 	m_fixed_walking = 0;
+	m_travel_waypoint = -1;
 
 	m_line_hor = cLine_collision();
 	m_line_ver = cLine_collision();
@@ -278,11 +279,18 @@ void cOverworld_Player :: Reset( void )
 	m_current_line = -2;
 
 	m_fixed_walking = 0;
+	Stop_Travel();
 	Set_Direction( DIR_UNDEFINED );
 }
 
 void cOverworld_Player :: Action_Interact( input_identifier key_type )
 {
+	// manual walking cancels the route
+	if( key_type == INP_LEFT || key_type == INP_RIGHT || key_type == INP_UP || key_type == INP_DOWN )
+	{
+		Stop_Travel();
+	}
+
 	// Left
 	if( key_type == INP_LEFT )
 	{
@@ -344,6 +352,8 @@ void cOverworld_Player :: Activate_Waypoint( void )
 		Game_Action_Data_Start.add( "screen_fadeout", CEGUI::PropertyHelper::intToString( EFFECT_OUT_FIXED_COLORBOX ) );
 		Game_Action_Data_Middle.add( "load_level", waypoint->Get_Destination() );
 		Game_Action_Data_End.add( "screen_fadein", CEGUI::PropertyHelper::intToString( EFFECT_IN_RANDOM ) );
+		// read the music while the screen and the current music fade out
+		pAudio->Prefetch_Music( pLevel_Manager->Get_Music_Filename( waypoint->Get_Destination() ) );
 	}
 	// world link waypoint
 	else if( waypoint->m_waypoint_type == WAYPOINT_WORLD_LINK )
@@ -367,7 +377,9 @@ void cOverworld_Player :: Activate_Waypoint( void )
 		// world link
 		else
 		{
-			if( pOverworld_Manager->Get( str_world ) )
+			cOverworld *overworld = pOverworld_Manager->Get( str_world );
+
+			if( overworld )
 			{
 				Game_Action = GA_ENTER_WORLD;
 				Game_Action_Data_Start.add( "music_fadeout", "1500" );
@@ -375,6 +387,8 @@ void cOverworld_Player :: Activate_Waypoint( void )
 				Game_Action_Data_Middle.add( "enter_world", str_world.c_str() );
 				Game_Action_Data_Middle.add( "world_player_waypoint", overworld_origin->m_description->m_path.c_str() );
 				Game_Action_Data_End.add( "screen_fadein", CEGUI::PropertyHelper::intToString( EFFECT_IN_BLACK ) );
+				// read the music while the screen and the current music fade out
+				pAudio->Prefetch_Music( overworld->m_musicfile );
 			}
 			else
 			{
@@ -565,20 +579,12 @@ void cOverworld_Player :: Update_Walk( void )
 
 	Auto_Pos_Correction();
 
-	// check if a new waypoint is near maryo
-	for( unsigned int i = 0; i < m_overworld->m_waypoints.size(); i++ )
-	{
-		// skip the start waypoint
-		if( static_cast<int>(i) == m_current_waypoint )
-		{
-			continue;
-		}
+	// check if a new waypoint is near maryo but skip the start waypoint
+	const int waypoint_num = m_overworld->Get_Waypoint_Collision( m_col_rect, m_current_waypoint );
 
-		if( m_overworld->m_waypoints[i]->m_rect.Intersects( m_col_rect ) )
-		{
-			Start_Waypoint_Walk( i );
-			break;
-		}
+	if( waypoint_num >= 0 )
+	{
+		Start_Waypoint_Walk( waypoint_num );
 	}
 }
 
@@ -642,9 +648,73 @@ void cOverworld_Player :: Update_Waypoint_Walk( void )
 		Set_Waypoint( m_current_waypoint );
 
 		pAudio->Play_Sound( "waypoint_reached.ogg" );
+
+		// continue the route if the expected waypoint was reached
+		if( m_travel_waypoint >= 0 )
+		{
+			if( m_current_waypoint == m_travel_waypoint )
+			{
+				Continue_Travel();
+			}
+			else
+			{
+				Stop_Travel();
+			}
+		}
 	}
 }
 
+bool cOverworld_Player :: Start_Travel( int waypoint )
+{
+	// if no waypoint or already walking
+	if( m_current_waypoint < 0 || m_direction != DIR_UNDEFINED || waypoint < 0 )
+	{
+		return 0;
+	}
+
+	Stop_Travel();
+
+	if( !m_overworld->Get_Route( m_current_waypoint, waypoint, m_travel_route ) || m_travel_route.empty() )
+	{
+		return 0;
+	}
+
+	if( pOverworld_Manager->m_debug_mode )
+	{
+		printf( "Travel from waypoint %d to %d over %u waypoints\n", m_current_waypoint, waypoint, static_cast<unsigned int>(m_travel_route.size()) );
+	}
+
+	return Continue_Travel();
+}
+
+void cOverworld_Player :: Stop_Travel( void )
+{
+	m_travel_route.clear();
+	m_travel_waypoint = -1;
+}
+
+bool cOverworld_Player :: Continue_Travel( void )
+{
+	// route finished
+	if( m_travel_route.empty() )
+	{
+		Stop_Travel();
+		return 0;
+	}
+
+	const cWaypoint_Link link = m_travel_route.front();
+	m_travel_route.erase( m_travel_route.begin() );
+
+	if( !Start_Walk( link.m_direction ) )
+	{
+		Stop_Travel();
+		return 0;
+	}
+
+	m_travel_waypoint = link.m_waypoint;
+	return 1;
+}
+
 bool cOverworld_Player :: Set_Waypoint( int waypoint, bool new_startpos /* = 0 */ )
 {
 	if( waypoint < 0 || waypoint >= static_cast<int>(m_overworld->m_waypoints.size()) ) 
@@ -84,6 +84,13 @@ public:
 	*/
 	void Update_Waypoint_Walk( void );
 
+	/* Walk the shortest route from the current to the given Waypoint
+	 * returns 0 if no route is available
+	*/
+	bool Start_Travel( int waypoint );
+	// Stop walking the route after the next Waypoint
+	void Stop_Travel( void );
+
 	// Set Maryo to the given Waypoint position
 	bool Set_Waypoint( int waypoint, bool new_startpos = 0 );
 	// Get current Waypoint
@@ -124,6 +131,14 @@ public:
 	cLine_collision m_line_ver;
 
 private:
+	// Start walking the next route link
+	bool Continue_Travel( void );
+
+	// route links not yet walked
+	WaypointLinkList m_travel_route;
+	// waypoint the current route link leads to
+	int m_travel_waypoint;
+
 	// Debug last set data
 	int m_debug_current_line_last;
 	int m_debug_lines_last;
@@ -70,7 +70,7 @@ void cWaypoint :: Init( void )
 	m_direction_forward = DIR_UNDEFINED;
 	m_direction_backward = DIR_UNDEFINED;
 
-	m_glim_color = Get_Random_Float( 0, 100 );
+	m_glim_color = Get_Random_Float( 0, 100, RANDOM_STREAM_VISUAL );
 	m_glim_mod = 1;
 
 	m_arrow_forward = NULL;
@@ -554,6 +554,16 @@ bool cWaypoint :: Editor_Access_Select( const CEGUI::EventArgs &event )
 	return 1;
 }
 
+/* *** *** *** *** *** *** *** *** cWaypoint_Link *** *** *** *** *** *** *** *** *** */
+
+cWaypoint_Link :: cWaypoint_Link( void )
+{
+	m_waypoint = -1;
+	m_direction = DIR_UNDEFINED;
+	m_length = 0.0f;
+	m_forward = 0;
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace SMC
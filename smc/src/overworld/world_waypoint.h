@@ -112,6 +112,26 @@ public:
 	cGL_Surface *m_arrow_backward;
 };
 
+/* *** *** *** *** *** *** cWaypoint_Link *** *** *** *** *** *** *** *** *** *** *** */
+
+// Walkable connection between two Waypoints over a layer line chain
+class cWaypoint_Link
+{
+public:
+	cWaypoint_Link( void );
+
+	// destination waypoint array number
+	int m_waypoint;
+	// walking direction from the source waypoint
+	ObjectDirection m_direction;
+	// length of the layer lines
+	float m_length;
+	// if set the destination waypoint must be accessible
+	bool m_forward;
+};
+
+typedef vector<cWaypoint_Link> WaypointLinkList;
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace SMC
@@ -0,0 +1,169 @@
+/***************************************************************************
+ * benchmark.cpp  -  game benchmarks
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../test/test.h"
+#include "../core/game_core.h"
+#include "../core/filesystem/filesystem.h"
+#include "../video/img_settings.h"
+#include "../video/animation.h"
+#include "../core/sprite_manager.h"
+#include "../enemies/furball.h"
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+void Benchmark_Image_Settings( void )
+{
+	const vector<std::string> files = Get_Directory_Files( DATA_DIR "/" GAME_PIXMAPS_DIR, ".settings" );
+
+	// every file alone
+	const Uint32 parse_start = SDL_GetTicks();
+
+	for( vector<std::string>::const_iterator itr = files.begin(); itr != files.end(); ++itr )
+	{
+		cImage_Settings_Parser parser;
+		delete parser.Get( *itr, 0 );
+	}
+
+	const Uint32 parse_ms = SDL_GetTicks() - parse_start;
+
+	// with base settings parsed once
+	cImage_Settings_Parser parser;
+	const Uint32 cached_start = SDL_GetTicks();
+
+	for( vector<std::string>::const_iterator itr = files.begin(); itr != files.end(); ++itr )
+	{
+		parser.Get_Cached( *itr );
+	}
+
+	const Uint32 cached_ms = SDL_GetTicks() - cached_start;
+
+	printf( "Image settings : parsed %u files in %u ms and with base settings in %u ms\n", static_cast<unsigned int>(files.size()), parse_ms, cached_ms );
+}
+
+void Benchmark_Animations( void )
+{
+	// animations of each type spawned every frame
+	const unsigned int count = 500;
+	const unsigned int frames = 100;
+
+	cAnimation_Manager animation_manager;
+	boost::posix_time::time_duration spawn_time;
+	boost::posix_time::time_duration update_time;
+	boost::posix_time::time_duration update_time_max;
+	unsigned int active_max = 0;
+
+	for( unsigned int frame = 0; frame < frames; frame++ )
+	{
+		const boost::posix_time::ptime spawn_start = boost::posix_time::microsec_clock::universal_time();
+
+		for( unsigned int i = 0; i < count; i++ )
+		{
+			const float posx = static_cast<float>( i * 10 );
+
+			animation_manager.Add( new cAnimation_Goldpiece( NULL, posx, 0.0f ) );
+			animation_manager.Add( new cAnimation_Fireball( NULL, posx, 100.0f, 10 ) );
+		}
+
+		const boost::posix_time::ptime update_start = boost::posix_time::microsec_clock::universal_time();
+		spawn_time += update_start - spawn_start;
+
+		if( animation_manager.size() > active_max )
+		{
+			active_max = animation_manager.size();
+		}
+
+		animation_manager.Update();
+
+		const boost::posix_time::time_duration frame_update_time = boost::posix_time::microsec_clock::universal_time() - update_start;
+		update_time += frame_update_time;
+
+		if( frame_update_time > update_time_max )
+		{
+			update_time_max = frame_update_time;
+		}
+	}
+
+	printf( "Animation benchmark : %u frames with up to %u animations, spawn %.3f ms and update %.3f ms average with %.3f ms maximum per frame\n", frames, active_max,
+		spawn_time.total_microseconds() * 0.001f / frames, update_time.total_microseconds() * 0.001f / frames, update_time_max.total_microseconds() * 0.001f );
+}
+
+void Benchmark_Sprite_Copy( void )
+{
+	// sprites copied into a sprite manager which already holds as many sprites
+	const unsigned int count = 1000;
+
+	cSprite_Manager sprite_manager( count * 4 );
+
+	// ground prototype
+	cSprite *prototype = new cSprite( &sprite_manager );
+	prototype->Set_Image( pVideo->Get_Surface( "ground/green_3/ground/top/1.png" ), 1 );
+	prototype->Set_Sprite_Type( TYPE_HALFMASSIVE );
+	prototype->Set_Pos( 0.0f, 0.0f, 1 );
+	sprite_manager.Add( prototype );
+
+	// enemy prototype
+	cFurball *enemy_prototype = new cFurball( &sprite_manager );
+	enemy_prototype->Set_Pos( 0.0f, -100.0f, 1 );
+	sprite_manager.Add( enemy_prototype );
+
+	// fill the level with the setup used before prototype copying
+	const boost::posix_time::ptime setup_start = boost::posix_time::microsec_clock::universal_time();
+
+	for( unsigned int i = 1; i < count; i++ )
+	{
+		cSprite *sprite = new cSprite( &sprite_manager );
+		sprite->Set_Image( prototype->m_start_image, 1 );
+		sprite->Set_Pos( static_cast<float>( i ) * prototype->m_start_rect.m_w, 0.0f, 1 );
+		sprite->Set_Sprite_Type( TYPE_HALFMASSIVE );
+		sprite_manager.Add( sprite );
+	}
+
+	const boost::posix_time::time_duration setup_time = boost::posix_time::microsec_clock::universal_time() - setup_start;
+	boost::posix_time::time_duration copy_time;
+	boost::posix_time::time_duration enemy_copy_time;
+	boost::posix_time::time_duration add_time;
+
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		const boost::posix_time::ptime copy_start = boost::posix_time::microsec_clock::universal_time();
+		cSprite *sprite = prototype->Copy();
+		const boost::posix_time::ptime enemy_copy_start = boost::posix_time::microsec_clock::universal_time();
+		cSprite *enemy = enemy_prototype->Copy();
+		const boost::posix_time::ptime add_start = boost::posix_time::microsec_clock::universal_time();
+
+		// like cMouseCursor::Copy
+		sprite->Set_Pos( static_cast<float>( i ) * prototype->m_start_rect.m_w, 64.0f, 1 );
+		sprite_manager.Add( sprite );
+		enemy->Set_Pos( static_cast<float>( i ) * 64.0f, -100.0f, 1 );
+		sprite_manager.Add( enemy );
+
+		const boost::posix_time::ptime add_end = boost::posix_time::microsec_clock::universal_time();
+		copy_time += enemy_copy_start - copy_start;
+		enemy_copy_time += add_start - enemy_copy_start;
+		add_time += add_end - add_start;
+	}
+
+	printf( "Copy benchmark : %u sprites set up in %.3f ms, copied in %.3f ms, %u enemies copied in %.3f ms, adding all copies %.3f ms\n", count,
+		setup_time.total_microseconds() * 0.001f, copy_time.total_microseconds() * 0.001f, count, enemy_copy_time.total_microseconds() * 0.001f, add_time.total_microseconds() * 0.001f );
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
@@ -0,0 +1,87 @@
+/***************************************************************************
+ * collision.cpp  -  collision tests
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../test/test.h"
+#include "../core/game_core.h"
+#include "../core/sprite_manager.h"
+#include "../enemies/furball.h"
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Add a massive ground sprite with the given collision width or the image width if zero
+static cSprite *Add_Collision_Test_Ground( cSprite_Manager *sprite_manager, float pos_x, float pos_y, float col_width = 0.0f )
+{
+	cSprite *sprite = new cSprite( sprite_manager );
+	sprite->Set_Image( pVideo->Get_Surface( "ground/green_3/ground/top/1.png" ), 1 );
+	sprite->Set_Sprite_Type( TYPE_MASSIVE );
+	sprite->Set_Pos( pos_x, pos_y, 1 );
+
+	if( col_width > 0.0f )
+	{
+		sprite->m_col_rect.m_w = col_width;
+	}
+
+	sprite_manager->Add( sprite );
+
+	return sprite;
+}
+
+void Test_Collision_Thin_Wall( void )
+{
+	cSprite_Manager sprite_manager;
+
+	// a wall thinner than the enemy moves in a single step
+	cSprite *wall = Add_Collision_Test_Ground( &sprite_manager, 600.0f, -300.0f, 2.0f );
+
+	cFurball *enemy = new cFurball( &sprite_manager );
+	enemy->Set_Pos( 200.0f, wall->m_col_rect.m_y, 1 );
+	sprite_manager.Add( enemy );
+
+	enemy->Col_Move( 1000.0f, 0.0f, 1, 0, 0 );
+
+	// stopped in front of the wall
+	const float enemy_right = enemy->m_col_rect.m_x + enemy->m_col_rect.m_w;
+	SMC_TEST_CHECK( enemy_right <= wall->m_col_rect.m_x );
+	SMC_TEST_CHECK( enemy_right >= wall->m_col_rect.m_x - 1.0f );
+	SMC_TEST_CHECK( enemy->Is_Collision_Included( wall ) );
+}
+
+void Test_Collision_Landing( void )
+{
+	cSprite_Manager sprite_manager;
+
+	cSprite *ground = Add_Collision_Test_Ground( &sprite_manager, 200.0f, -100.0f );
+	Add_Collision_Test_Ground( &sprite_manager, 200.0f + ground->m_col_rect.m_w, -100.0f );
+
+	cFurball *enemy = new cFurball( &sprite_manager );
+	enemy->Set_Pos( 220.0f, -600.0f, 1 );
+	sprite_manager.Add( enemy );
+
+	// falls further than the ground is high in a single move
+	enemy->Col_Move( 5.0f, 600.0f, 1 );
+
+	// rests on top of the ground
+	const float enemy_bottom = enemy->m_col_rect.m_y + enemy->m_col_rect.m_h;
+	SMC_TEST_CHECK( enemy_bottom <= ground->m_col_rect.m_y );
+	SMC_TEST_CHECK( enemy_bottom >= ground->m_col_rect.m_y - 1.0f );
+	SMC_TEST_CHECK( enemy->m_ground_object != NULL );
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
@@ -0,0 +1,157 @@
+/***************************************************************************
+ * test.cpp  -  game tests and benchmarks runner
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../test/test.h"
+#include "../core/main.h"
+#include "../core/game_core.h"
+#include "../core/filesystem/filesystem.h"
+
+// SMC namespace is set later to exclude main() from it
+using namespace SMC;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// failed checks
+static unsigned int test_failed_checks = 0;
+// exit status of a skipped test for automake
+static const int test_skipped = 77;
+
+typedef void (*Test_Function)( void );
+
+// a test or benchmark with its name
+struct cTest_Entry
+{
+	const char *m_name;
+	Test_Function m_function;
+};
+
+// tests run every time
+static const cTest_Entry tests[] =
+{
+	{ "collision thin wall", Test_Collision_Thin_Wall },
+	{ "collision landing", Test_Collision_Landing },
+	{ "update determinism", Test_Update_Determinism },
+	{ NULL, NULL }
+};
+
+// benchmarks run if requested
+static const cTest_Entry benchmarks[] =
+{
+	{ "image settings", Benchmark_Image_Settings },
+	{ "animations", Benchmark_Animations },
+	{ "sprite copy", Benchmark_Sprite_Copy },
+	{ NULL, NULL }
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+int main( int argc, char **argv )
+{
+	bool run_benchmarks = 0;
+
+	for( int i = 1; i < argc; i++ )
+	{
+		const std::string argument = argv[i];
+
+		if( argument == "--benchmark" || argument == "-b" )
+		{
+			run_benchmarks = 1;
+		}
+		else
+		{
+			printf( "Usage: %s [OPTIONS]\n", argv[0] );
+			printf( "Runs the tests and returns a failure if a check failed\n" );
+			printf( "-b, --benchmark\tAlso run the benchmarks\n" );
+			return EXIT_FAILURE;
+		}
+	}
+
+	// the game exits on a failed initialization so skip if the data or a display is not available
+	if( !Dir_Exists( DATA_DIR ) )
+	{
+		printf( "Game data directory %s not found, tests skipped\n", DATA_DIR );
+		return test_skipped;
+	}
+
+	if( SDL_Init( SDL_INIT_VIDEO ) == -1 )
+	{
+		printf( "Video initialization failed : %s, tests skipped\n", SDL_GetError() );
+		return test_skipped;
+	}
+
+	SDL_Quit();
+
+	try
+	{
+		// initialize everything
+		Init_Game();
+	}
+	catch( const std::exception &e )
+	{
+		printf( "Initialization: Exception raised: %s, tests skipped\n", e.what() );
+		return test_skipped;
+	}
+
+	unsigned int failed_tests = 0;
+
+	for( const cTest_Entry *test = tests; test->m_function; test++ )
+	{
+		const unsigned int failed_checks = test_failed_checks;
+
+		test->m_function();
+
+		if( failed_checks != test_failed_checks )
+		{
+			printf( "Test %s : failed\n", test->m_name );
+			failed_tests++;
+		}
+		else
+		{
+			printf( "Test %s : passed\n", test->m_name );
+		}
+	}
+
+	if( run_benchmarks )
+	{
+		for( const cTest_Entry *benchmark = benchmarks; benchmark->m_function; benchmark++ )
+		{
+			printf( "Benchmark %s\n", benchmark->m_name );
+			benchmark->m_function();
+		}
+	}
+
+	Exit_Game();
+
+	return failed_tests ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// namespace is set here to exclude main() from it
+namespace SMC
+{
+
+bool Test_Check( bool condition, const char *check, const char *file, int line )
+{
+	if( !condition )
+	{
+		printf( "%s:%d : Check failed : %s\n", file, line, check );
+		test_failed_checks++;
+	}
+
+	return condition;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
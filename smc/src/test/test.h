@@ -0,0 +1,62 @@
+/***************************************************************************
+ * test.h  -  game tests and benchmarks
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SMC_TEST_H
+#define SMC_TEST_H
+
+#include "../core/global_basic.h"
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Report the failed check with its location
+ * returns the condition
+*/
+bool Test_Check( bool condition, const char *check, const char *file, int line );
+
+// Check the condition in a test
+#define SMC_TEST_CHECK( condition ) SMC::Test_Check( ( condition ) ? 1 : 0, #condition, __FILE__, __LINE__ )
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Tests
+ * run after the game is initialized and report failures with SMC_TEST_CHECK
+*/
+
+// Move an enemy fast against a wall thinner than the move
+void Test_Collision_Thin_Wall( void );
+// Drop an enemy fast onto the ground
+void Test_Collision_Landing( void );
+// Update and collide a level of enemies with the serial and the parallel update and compare the object state after every frame
+void Test_Update_Determinism( void );
+
+/* Benchmarks
+ * run after the tests if requested and print the needed time
+*/
+
+// Parse all image settings files without and with the settings cache
+void Benchmark_Image_Settings( void );
+// Spawn and update many goldpiece and fireball animations and print the time needed per frame
+void Benchmark_Animations( void );
+// Copy sprites and add them like the editor fast copy
+void Benchmark_Sprite_Copy( void );
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
+
+#endif
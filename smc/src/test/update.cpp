@@ -0,0 +1,175 @@
+/***************************************************************************
+ * update.cpp  -  object update tests
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../test/test.h"
+#include "../core/game_core.h"
+#include "../core/sprite_manager.h"
+#include "../core/math/random.h"
+#include "../enemies/furball.h"
+#include "../video/gl_surface.h"
+
+#include <boost/functional/hash.hpp>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Create a floor with walls and enemies on it for the update determinism test
+// if animation_parallel is not set the enemies use the single phase update
+static void Create_Update_Check_Level( cSprite_Manager &sprite_manager, unsigned int count, float start_x, float start_y, bool animation_parallel )
+{
+	cGL_Surface *image = pVideo->Get_Surface( "ground/green_3/ground/top/1.png" );
+	const unsigned int columns = 25;
+	const unsigned int rows = ( count + columns - 1 ) / columns;
+	const float spacing = 48.0f;
+	const unsigned int floor_tiles = static_cast<unsigned int>( ( columns * spacing ) / image->m_w ) + 2;
+	const unsigned int wall_tiles = static_cast<unsigned int>( ( rows * spacing ) / image->m_h ) + 2;
+
+	// floor
+	for( unsigned int i = 0; i <= floor_tiles; i++ )
+	{
+		cSprite *sprite = new cSprite( &sprite_manager );
+		sprite->Set_Image( image, 1 );
+		sprite->Set_Pos( start_x + ( static_cast<float>(i) - 1.0f ) * image->m_w, start_y, 1 );
+		sprite->Set_Sprite_Type( TYPE_MASSIVE );
+		sprite_manager.Add( sprite );
+	}
+
+	// walls
+	for( unsigned int i = 1; i <= wall_tiles; i++ )
+	{
+		for( unsigned int side = 0; side < 2; side++ )
+		{
+			cSprite *sprite = new cSprite( &sprite_manager );
+			sprite->Set_Image( image, 1 );
+			sprite->Set_Pos( start_x + ( side ? static_cast<float>(floor_tiles) - 1.0f : -1.0f ) * image->m_w, start_y - static_cast<float>(i) * image->m_h, 1 );
+			sprite->Set_Sprite_Type( TYPE_MASSIVE );
+			sprite_manager.Add( sprite );
+		}
+	}
+
+	// enemies
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		cFurball *enemy = new cFurball( &sprite_manager );
+		enemy->Set_Pos( start_x + static_cast<float>( i % columns ) * spacing, start_y - static_cast<float>( i / columns + 1 ) * spacing, 1 );
+		enemy->m_update_animation_parallel = animation_parallel;
+		sprite_manager.Add( enemy );
+	}
+}
+
+// Return a hash of the object state
+static std::size_t Get_Update_Check_Hash( const cSprite_Manager &sprite_manager )
+{
+	std::size_t hash = 0;
+
+	for( cSprite_List::const_iterator itr = sprite_manager.objects.begin(); itr != sprite_manager.objects.end(); ++itr )
+	{
+		const cSprite *obj = (*itr);
+
+		boost::hash_combine( hash, obj->m_pos_x );
+		boost::hash_combine( hash, obj->m_pos_y );
+		boost::hash_combine( hash, obj->m_col_rect.m_w );
+		boost::hash_combine( hash, obj->m_col_rect.m_h );
+		boost::hash_combine( hash, obj->m_rot_z );
+		boost::hash_combine( hash, obj->m_image );
+		boost::hash_combine( hash, obj->m_auto_destroy );
+
+		const cAnimated_Sprite *animated = dynamic_cast<const cAnimated_Sprite *>(obj);
+
+		if( animated )
+		{
+			boost::hash_combine( hash, animated->m_anim_counter );
+		}
+	}
+
+	return hash;
+}
+
+void Test_Update_Determinism( void )
+{
+	const unsigned int count = 500;
+	const unsigned int frames = 300;
+	// far away from the player
+	const float start_x = 100000.0f;
+	const float start_y = -100000.0f;
+
+	// the enemies must be in the camera range
+	const float camera_x = pActive_Camera->m_x;
+	const float camera_y = pActive_Camera->m_y;
+	pActive_Camera->m_x = start_x;
+	pActive_Camera->m_y = start_y - static_cast<float>(game_res_h);
+
+	// every run starts with the same random values
+	cRandom_Generator random_streams[RANDOM_STREAM_AMOUNT];
+
+	for( unsigned int i = 0; i < RANDOM_STREAM_AMOUNT; i++ )
+	{
+		random_streams[i] = Get_Random_Generator( static_cast<RandomStream>(i) );
+	}
+
+	// single phase reference run, serial and parallel two phase run
+	const unsigned int runs = 3;
+	vector<std::size_t> hashes;
+	hashes.reserve( frames );
+	unsigned int failed_frame[runs] = { frames, frames, frames };
+
+	for( unsigned int run = 0; run < runs; run++ )
+	{
+		for( unsigned int i = 0; i < RANDOM_STREAM_AMOUNT; i++ )
+		{
+			Get_Random_Generator( static_cast<RandomStream>(i) ) = random_streams[i];
+		}
+
+		cSprite_Manager sprite_manager( count * 2 );
+		sprite_manager.m_parallel_update = run == 2;
+		Create_Update_Check_Level( sprite_manager, count, start_x, start_y, run > 0 );
+
+		for( unsigned int frame = 0; frame < frames; frame++ )
+		{
+			sprite_manager.Update_Items();
+			sprite_manager.Handle_Collision_Items();
+
+			const std::size_t hash = Get_Update_Check_Hash( sprite_manager );
+
+			if( !run )
+			{
+				hashes.push_back( hash );
+			}
+			else if( hash != hashes[frame] && failed_frame[run] == frames )
+			{
+				failed_frame[run] = frame;
+			}
+		}
+	}
+
+	pActive_Camera->m_x = camera_x;
+	pActive_Camera->m_y = camera_y;
+
+	// the two phase update matches the single phase update in every frame
+	if( !SMC_TEST_CHECK( failed_frame[1] == frames ) )
+	{
+		printf( "Serial two phase update differs from the single phase update at frame %u\n", failed_frame[1] );
+	}
+	if( !SMC_TEST_CHECK( failed_frame[2] == frames ) )
+	{
+		printf( "Parallel update differs from the single phase update at frame %u\n", failed_frame[2] );
+	}
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
@@ -180,6 +180,8 @@ void cPreferences :: Save( void )
 		return;
 	}
 
+	pResource_Manager->Set_Indexed_File( m_config_filename, 1 );
+
 	CEGUI::XMLSerializer stream( file );
 
 	// begin
@@ -265,6 +265,13 @@ int cSavegame :: Load_Game( unsigned int save_slot )
 				continue;
 			}
 
+			// worlds are loaded when needed
+			if( !pOverworld_Manager->Load_World( overworld ) )
+			{
+				printf( "Warning : Savegame %d : Overworld %s could not be loaded\n", save_slot, save_overworld->m_name.c_str() );
+				continue;
+			}
+
 			for( Save_Overworld_WaypointList::iterator wp_itr = save_overworld->m_waypoints.begin(); wp_itr != save_overworld->m_waypoints.end(); ++wp_itr )
 			{
 				// get savegame waypoint pointer
@@ -502,6 +509,12 @@ bool cSavegame :: Save_Game( unsigned int save_slot, std::string description )
 		// Get Overworld
 		cOverworld *overworld = (*itr);
 
+		// not loaded worlds have the default progress
+		if( !overworld->Is_Loaded() )
+		{
+			continue;
+		}
+
 		// create Overworld
 		cSave_Overworld *save_overworld = new cSave_Overworld();
 		save_overworld->m_name = overworld->m_description->m_name;
@@ -604,6 +617,8 @@ int cSavegame :: Save( unsigned int save_slot, cSave *savegame )
 		return 0;
 	}
 
+	pResource_Manager->Set_Indexed_File( filename, 1 );
+
 	CEGUI::XMLSerializer stream( file );
 
 	// begin
@@ -22,6 +22,7 @@
 #include "../core/i18n.h"
 #include "../core/filesystem/filesystem.h"
 #include "../input/mouse.h"
+#include "../core/memory_pool.h"
 // CEGUI
 #include "CEGUIXMLAttributes.h"
 #include "CEGUIWindowManager.h"
@@ -33,6 +34,12 @@
 namespace SMC
 {
 
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+static cMemory_Pool goldpiece_memory_pool( sizeof(cAnimation_Goldpiece), 64 );
+static cMemory_Pool fireball_memory_pool( sizeof(cAnimation_Fireball), 64 );
+static cMemory_Pool fireball_item_memory_pool( sizeof(cAnimation_Fireball_Item), 256 );
+
 /* *** *** *** *** *** *** *** Base Animation class *** *** *** *** *** *** *** *** *** *** */
 
 cAnimation :: cAnimation( cSprite_Manager *sprite_manager, std::string type_name /* = "sprite" */ )
@@ -111,7 +118,7 @@ cAnimation_Goldpiece :: cAnimation_Goldpiece( cSprite_Manager *sprite_manager, f
 	{
 		cSprite *obj = new cSprite( m_sprite_manager );
 		obj->Set_Image( m_images[0].m_image );
-		obj->Set_Pos( m_pos_x + Get_Random_Float( 0.0f, m_rect.m_w ), m_pos_y + Get_Random_Float( 0.0f, m_rect.m_h ) );
+		obj->Set_Pos( m_pos_x + Get_Random_Float( 0.0f, m_rect.m_w, RANDOM_STREAM_PARTICLE ), m_pos_y + Get_Random_Float( 0.0f, m_rect.m_h, RANDOM_STREAM_PARTICLE ) );
 		obj->m_pos_z = m_pos_z;
 		obj->Set_Scale_X( m_scale_x, 1 );
 		obj->Set_Scale_Y( m_scale_y, 1 );
@@ -133,6 +140,16 @@ cAnimation_Goldpiece :: ~cAnimation_Goldpiece( void )
 	m_objects.clear();
 }
 
+void *cAnimation_Goldpiece :: operator new( size_t size )
+{
+	return goldpiece_memory_pool.Allocate( size );
+}
+
+void cAnimation_Goldpiece :: operator delete( void *ptr, size_t size )
+{
+	goldpiece_memory_pool.Release( ptr, size );
+}
+
 void cAnimation_Goldpiece :: Update( void )
 {
 	if( !m_active || editor_enabled )
@@ -241,6 +258,11 @@ void cAnimation_Goldpiece :: Update( void )
 		obj->Set_Scale( 1.1f - ( m_time_to_live / 12 ) );
 		count++;
 	}
+
+	if( m_time_to_live > 11.0f || m_time_to_live < 0.0f )
+	{
+		Set_Active( 0 );
+	}
 }
 
 void cAnimation_Goldpiece :: Draw( cSurface_Request *request /* = NULL */ )
@@ -258,13 +280,26 @@ void cAnimation_Goldpiece :: Draw( cSurface_Request *request /* = NULL */ )
 
 		obj->Draw();
 	}
-	
+
+	// also finish if not updated like in the editor
 	if( m_time_to_live > 11.0f || m_time_to_live < 0.0f )
 	{
 		Set_Active( 0 );
 	}
 }
 
+/* *** *** *** *** *** *** *** cAnimation_Fireball_Item *** *** *** *** *** *** *** *** *** *** */
+
+void *cAnimation_Fireball_Item :: operator new( size_t size )
+{
+	return fireball_item_memory_pool.Allocate( size );
+}
+
+void cAnimation_Fireball_Item :: operator delete( void *ptr, size_t size )
+{
+	fireball_item_memory_pool.Release( ptr, size );
+}
+
 /* *** *** *** *** *** *** *** cAnimation_Fireball *** *** *** *** *** *** *** *** *** *** */
 
 cAnimation_Fireball :: cAnimation_Fireball( cSprite_Manager *sprite_manager, float posx, float posy, unsigned int power /* = 5 */ )
@@ -285,18 +320,18 @@ cAnimation_Fireball :: cAnimation_Fireball( cSprite_Manager *sprite_manager, flo
 		obj->Set_Image_Num( 0 );
 
 		// velocity
-		obj->m_velx = Get_Random_Float( -2.5f, 5 );
-		obj->m_vely = Get_Random_Float( -2.5f, 5 );
+		obj->m_velx = Get_Random_Float( -2.5f, 5, RANDOM_STREAM_PARTICLE );
+		obj->m_vely = Get_Random_Float( -2.5f, 5, RANDOM_STREAM_PARTICLE );
 
 		// Z position
 		obj->m_pos_z = m_pos_z;
 		if( m_pos_z_rand > 0 )
 		{
-			obj->m_pos_z += Get_Random_Float( 0, m_pos_z_rand );
+			obj->m_pos_z += Get_Random_Float( 0, m_pos_z_rand, RANDOM_STREAM_PARTICLE );
 		}
 
 		// lifetime
-		obj->m_counter = Get_Random_Float( 8, 13 );
+		obj->m_counter = Get_Random_Float( 8, 13, RANDOM_STREAM_PARTICLE );
 
 		m_objects.push_back( obj );
 	}
@@ -313,6 +348,16 @@ cAnimation_Fireball :: ~cAnimation_Fireball( void )
 	m_objects.clear();
 }
 
+void *cAnimation_Fireball :: operator new( size_t size )
+{
+	return fireball_memory_pool.Allocate( size );
+}
+
+void cAnimation_Fireball :: operator delete( void *ptr, size_t size )
+{
+	fireball_memory_pool.Release( ptr, size );
+}
+
 void cAnimation_Fireball :: Update( void )
 {
 	if( !m_active || editor_enabled )
@@ -384,133 +429,131 @@ void cAnimation_Fireball :: Draw( cSurface_Request *request /* = NULL */ )
 	}
 }
 
-/* *** *** *** *** *** *** *** cParticle *** *** *** *** *** *** *** *** *** *** */
+/* *** *** *** *** *** *** *** cParticle_Pool *** *** *** *** *** *** *** *** *** *** */
 
-cParticle :: cParticle( cParticle_Emitter *parent )
-: cMovingSprite( parent->m_sprite_manager )
+cParticle_Pool :: cParticle_Pool( void )
 {
-	m_can_be_on_ground = 0;
-	// scale centered
-	Set_Scale_Directions( 1, 1, 1, 1 );
 
-	m_time_to_live = 0.0f;
-	m_const_rot_x = 0.0f;
-	m_const_rot_y = 0.0f;
-	m_const_rot_z = 0.0f;
-	m_gravity_x = 0.0f;
-	m_gravity_y = 0.0f;
-
-	m_fade_pos = 1.0f;
-
-	m_parent = parent;
 }
 
-cParticle :: ~cParticle( void )
+cParticle_Pool :: ~cParticle_Pool( void )
 {
 
 }
 
-void cParticle :: Update( void )
+unsigned int cParticle_Pool :: Add( unsigned int count /* = 1 */ )
 {
-	// update fade modifier
-	m_fade_pos -= ( ( static_cast<float>(speedfactor_fps) * 0.001f ) * pFramerate->m_speed_factor ) / m_time_to_live;
+	const unsigned int first = m_pos_x.size();
+	const unsigned int new_size = first + count;
 
-	// finished fading
-	if( m_fade_pos <= 0.0f )
-	{
-		m_fade_pos = 0.0f;
-		Set_Active( 0 );
-		return;
-	}
-
-	// with size fading
-	if( m_parent->m_fade_size )
-	{
-		Set_Scale( m_start_scale_x * m_fade_pos );
-	}
+	m_pos_x.resize( new_size, 0.0f );
+	m_pos_y.resize( new_size, 0.0f );
+	m_pos_z.resize( new_size, 0.0f );
+	m_vel_x.resize( new_size, 0.0f );
+	m_vel_y.resize( new_size, 0.0f );
+	m_gravity_x.resize( new_size, 0.0f );
+	m_gravity_y.resize( new_size, 0.0f );
+	m_rot_x.resize( new_size, 0.0f );
+	m_rot_y.resize( new_size, 0.0f );
+	m_rot_z.resize( new_size, 0.0f );
+	m_const_rot_x.resize( new_size, 0.0f );
+	m_const_rot_y.resize( new_size, 0.0f );
+	m_const_rot_z.resize( new_size, 0.0f );
+	m_scale.resize( new_size, 1.0f );
+	m_start_scale.resize( new_size, 1.0f );
+	m_time_to_live.resize( new_size, 0.0f );
+	m_fade_pos.resize( new_size, 1.0f );
+	m_color.resize( new_size, white );
 
-	// move
-	Move( m_velx, m_vely );
-	// todo : gravity maximum
-	Add_Velocity( m_gravity_x, m_gravity_y );
-
-	// constant rotation
-	if( !Is_Float_Equal( m_const_rot_x, 0.0f ) )
-	{
-		Add_Rotation_X( m_const_rot_x * pFramerate->m_speed_factor );
-	}
-	if( !Is_Float_Equal( m_const_rot_y, 0.0f ) )
-	{
-		Add_Rotation_Y( m_const_rot_y * pFramerate->m_speed_factor );
-	}
-	if( !Is_Float_Equal( m_const_rot_z, 0.0f ) )
-	{
-		Add_Rotation_Z( m_const_rot_z * pFramerate->m_speed_factor );
-	}
+	return first;
 }
 
-void cParticle :: Draw( cSurface_Request *request /* = NULL */ )
+void cParticle_Pool :: Remove_Finished( void )
 {
-	if( !m_image )
-	{
-		return;
-	}
+	const unsigned int count = m_pos_x.size();
+	unsigned int used = 0;
 
-	bool create_request = 0;
-
-	if( !request )
-	{
-		create_request = 1;
-		// create request
-		request = new cSurface_Request();
-	}
-
-	Draw_Image_Normal( request );
-
-	// based on emitter position
-	if( m_parent->m_particle_based_on_emitter_pos > 0.0f )
+	for( unsigned int i = 0; i < count; i++ )
 	{
-		request->m_pos_x += (m_parent->m_pos_x * m_parent->m_particle_based_on_emitter_pos);
-		request->m_pos_y += (m_parent->m_pos_y * m_parent->m_particle_based_on_emitter_pos);
-	}
-	
-	// blending
-	if( m_parent->m_blending == BLEND_ADD )
-	{
-		request->m_blend_sfactor = GL_SRC_ALPHA;
-		request->m_blend_dfactor = GL_ONE;
-	}
-	else if( m_parent->m_blending == BLEND_DRIVE )
-	{
-		request->m_blend_sfactor = GL_SRC_COLOR;
-		request->m_blend_dfactor = GL_DST_ALPHA;
-	}
+		// finished
+		if( m_fade_pos[i] <= 0.0f )
+		{
+			continue;
+		}
 
-	// color fading
-	if( m_parent->m_fade_color )
-	{
-		request->m_color.red = static_cast<Uint8>(m_color.red * m_fade_pos);
-		request->m_color.green = static_cast<Uint8>(m_color.green * m_fade_pos);
-		request->m_color.blue = static_cast<Uint8>(m_color.blue * m_fade_pos);
-	}
+		// move down
+		if( used != i )
+		{
+			m_pos_x[used] = m_pos_x[i];
+			m_pos_y[used] = m_pos_y[i];
+			m_pos_z[used] = m_pos_z[i];
+			m_vel_x[used] = m_vel_x[i];
+			m_vel_y[used] = m_vel_y[i];
+			m_gravity_x[used] = m_gravity_x[i];
+			m_gravity_y[used] = m_gravity_y[i];
+			m_rot_x[used] = m_rot_x[i];
+			m_rot_y[used] = m_rot_y[i];
+			m_rot_z[used] = m_rot_z[i];
+			m_const_rot_x[used] = m_const_rot_x[i];
+			m_const_rot_y[used] = m_const_rot_y[i];
+			m_const_rot_z[used] = m_const_rot_z[i];
+			m_scale[used] = m_scale[i];
+			m_start_scale[used] = m_start_scale[i];
+			m_time_to_live[used] = m_time_to_live[i];
+			m_fade_pos[used] = m_fade_pos[i];
+			m_color[used] = m_color[i];
+		}
 
-	// alpha fading
-	if( m_parent->m_fade_alpha )
-	{
-		request->m_color.alpha = static_cast<Uint8>(request->m_color.alpha * m_fade_pos);
+		used++;
 	}
 
-	if( create_request )
+	// nothing removed
+	if( used == count )
 	{
-		// add request
-		pRenderer->Add( request );
+		return;
 	}
-}
 
-void cParticle :: Set_Gravity( float x, float y )
-{
-	m_gravity_x = x;
-	m_gravity_y = y;
+	// resize never frees the memory so the next particles reuse it
+	m_pos_x.resize( used );
+	m_pos_y.resize( used );
+	m_pos_z.resize( used );
+	m_vel_x.resize( used );
+	m_vel_y.resize( used );
+	m_gravity_x.resize( used );
+	m_gravity_y.resize( used );
+	m_rot_x.resize( used );
+	m_rot_y.resize( used );
+	m_rot_z.resize( used );
+	m_const_rot_x.resize( used );
+	m_const_rot_y.resize( used );
+	m_const_rot_z.resize( used );
+	m_scale.resize( used );
+	m_start_scale.resize( used );
+	m_time_to_live.resize( used );
+	m_fade_pos.resize( used );
+	m_color.resize( used );
+}
+
+void cParticle_Pool :: Clear( void )
+{
+	m_pos_x.clear();
+	m_pos_y.clear();
+	m_pos_z.clear();
+	m_vel_x.clear();
+	m_vel_y.clear();
+	m_gravity_x.clear();
+	m_gravity_y.clear();
+	m_rot_x.clear();
+	m_rot_y.clear();
+	m_rot_z.clear();
+	m_const_rot_x.clear();
+	m_const_rot_y.clear();
+	m_const_rot_z.clear();
+	m_scale.clear();
+	m_start_scale.clear();
+	m_time_to_live.clear();
+	m_fade_pos.clear();
+	m_color.clear();
 }
 
 /* *** *** *** *** *** *** *** cParticle_Emitter *** *** *** *** *** *** *** *** *** *** */
@@ -591,6 +634,8 @@ void cParticle_Emitter :: Init( void )
 	m_clip_rect = GL_rect();
 	m_clip_mode = PCM_MOVE;
 
+	m_effect = 0;
+
 	// animation data
 	m_emit_counter = 0.0f;
 	m_emitter_living_time = 0.0f;
@@ -599,33 +644,44 @@ void cParticle_Emitter :: Init( void )
 cParticle_Emitter *cParticle_Emitter :: Copy( void ) const
 {
 	cParticle_Emitter *particle_animation = new cParticle_Emitter( m_sprite_manager );
-	particle_animation->Set_Based_On_Camera_Pos( m_emitter_based_on_camera_pos );
-	particle_animation->Set_Particle_Based_On_Emitter_Pos( m_particle_based_on_emitter_pos );
-	particle_animation->Set_Pos( m_start_pos_x, m_start_pos_y, 1 );
-	particle_animation->Set_Pos_Z( m_pos_z, m_pos_z_rand );
-	particle_animation->Set_Image_Filename( m_image_filename.c_str() );
-	particle_animation->Set_Emitter_Rect( m_rect );
-	particle_animation->Set_Emitter_Time_to_Live( m_emitter_time_to_live );
-	particle_animation->Set_Emitter_Iteration_Interval( m_emitter_iteration_interval );
-	particle_animation->Set_Quota( m_emitter_quota );
-	particle_animation->Set_Time_to_Live( m_time_to_live, m_time_to_live_rand );
-	particle_animation->Set_Speed( m_vel, m_vel_rand );
-	particle_animation->Set_Rotation( m_start_rot_x, m_start_rot_y, m_start_rot_z, 1 );
-	particle_animation->Set_Start_Rot_Z_Uses_Direction( m_start_rot_z_uses_direction );
-	particle_animation->Set_Const_Rotation_X( m_const_rot_x, m_const_rot_x_rand );
-	particle_animation->Set_Const_Rotation_Y( m_const_rot_y, m_const_rot_y_rand );
-	particle_animation->Set_Const_Rotation_Z( m_const_rot_z, m_const_rot_z_rand );
-	particle_animation->Set_Direction_Range( m_angle_start, m_angle_range );
-	particle_animation->Set_Scale( m_size_scale, m_size_scale_rand );
-	particle_animation->Set_Color( m_color, m_color_rand );
-	particle_animation->Set_Horizontal_Gravity( m_gravity_x, m_gravity_x_rand );
-	particle_animation->Set_Vertical_Gravity( m_gravity_y, m_gravity_y_rand );
-	particle_animation->Set_Spawned( m_spawned );
-	particle_animation->Set_Clip_Rect( m_clip_rect );
-	particle_animation->Set_Clip_Mode( m_clip_mode );
+	particle_animation->Set_Settings( this );
 	return particle_animation;
 }
 
+void cParticle_Emitter :: Set_Settings( const cParticle_Emitter *emitter )
+{
+	Set_Based_On_Camera_Pos( emitter->m_emitter_based_on_camera_pos );
+	Set_Particle_Based_On_Emitter_Pos( emitter->m_particle_based_on_emitter_pos );
+	Set_Pos( emitter->m_start_pos_x, emitter->m_start_pos_y, 1 );
+	Set_Pos_Z( emitter->m_pos_z, emitter->m_pos_z_rand );
+	// image is also copied if not set from a filename
+	m_image_filename = emitter->m_image_filename;
+	m_image = emitter->m_image;
+	Set_Emitter_Rect( emitter->m_rect );
+	Set_Emitter_Time_to_Live( emitter->m_emitter_time_to_live );
+	Set_Emitter_Iteration_Interval( emitter->m_emitter_iteration_interval );
+	Set_Quota( emitter->m_emitter_quota );
+	Set_Time_to_Live( emitter->m_time_to_live, emitter->m_time_to_live_rand );
+	Set_Speed( emitter->m_vel, emitter->m_vel_rand );
+	Set_Rotation( emitter->m_start_rot_x, emitter->m_start_rot_y, emitter->m_start_rot_z, 1 );
+	Set_Start_Rot_Z_Uses_Direction( emitter->m_start_rot_z_uses_direction );
+	Set_Const_Rotation_X( emitter->m_const_rot_x, emitter->m_const_rot_x_rand );
+	Set_Const_Rotation_Y( emitter->m_const_rot_y, emitter->m_const_rot_y_rand );
+	Set_Const_Rotation_Z( emitter->m_const_rot_z, emitter->m_const_rot_z_rand );
+	Set_Direction_Range( emitter->m_angle_start, emitter->m_angle_range );
+	Set_Scale( emitter->m_size_scale, emitter->m_size_scale_rand );
+	Set_Color( emitter->m_color, emitter->m_color_rand );
+	Set_Horizontal_Gravity( emitter->m_gravity_x, emitter->m_gravity_x_rand );
+	Set_Vertical_Gravity( emitter->m_gravity_y, emitter->m_gravity_y_rand );
+	Set_Fading_Size( emitter->m_fade_size );
+	Set_Fading_Alpha( emitter->m_fade_alpha );
+	Set_Fading_Color( emitter->m_fade_color );
+	Set_Blending( emitter->m_blending );
+	Set_Spawned( emitter->m_spawned );
+	Set_Clip_Rect( emitter->m_clip_rect );
+	Set_Clip_Mode( emitter->m_clip_mode );
+}
+
 void cParticle_Emitter :: Load_From_XML( CEGUI::XMLAttributes &attributes )
 {
 	// filename
@@ -776,148 +832,120 @@ void cParticle_Emitter :: Pre_Update( void )
 	pFramerate->m_speed_factor = old_speedfactor;
 }
 
+/* Set the particle values to base and add a random value from 0 to range
+ * used to initialize all particles of an emission at once
+*/
+static void Emit_Particle_Values( cRandom_Generator &random, float *values, unsigned int count, float base, float range )
+{
+	std::fill( values, values + count, base );
+
+	if( range > 0.0f )
+	{
+		random.Add_Float( values, count, range );
+	}
+}
+
 void cParticle_Emitter :: Emit( void )
 {
-	if( !m_image )
+	if( !m_image || !m_emitter_quota )
 	{
 		return;
 	}
 
-	for( unsigned int i = 0; i < m_emitter_quota; i++ )
-	{
-		cParticle *particle = new cParticle( this );
+	cRandom_Generator &random = Get_Random_Generator( RANDOM_STREAM_PARTICLE );
+	const unsigned int count = m_emitter_quota;
+	const unsigned int first = m_particles.Add( count );
 
-		// X Position
-		float x = m_pos_x - ( m_image->m_w * 0.5f );
-		if( m_rect.m_w > 0.0f )
-		{
-			x += Get_Random_Float( 0.0f, m_rect.m_w );
-		}
-		// Y Position
-		float y = m_pos_y - ( m_image->m_h * 0.5f );
-		if( m_rect.m_h > 0.0f )
-		{
-			y += Get_Random_Float( 0.0f, m_rect.m_h );
-		}
-		// Set Position
-		particle->Set_Pos( x, y, 1 );
+	// Position
+	Emit_Particle_Values( random, &m_particles.m_pos_x[first], count, m_pos_x - ( m_image->m_w * 0.5f ), m_rect.m_w );
+	Emit_Particle_Values( random, &m_particles.m_pos_y[first], count, m_pos_y - ( m_image->m_h * 0.5f ), m_rect.m_h );
+	// Z position
+	Emit_Particle_Values( random, &m_particles.m_pos_z[first], count, m_pos_z, m_pos_z_rand );
 
-		// Image
-		particle->Set_Image( m_image, 1 );
+	// Start rotation
+	Emit_Particle_Values( random, &m_particles.m_rot_x[first], count, m_start_rot_x, 0.0f );
+	Emit_Particle_Values( random, &m_particles.m_rot_y[first], count, m_start_rot_y, 0.0f );
+	Emit_Particle_Values( random, &m_particles.m_rot_z[first], count, m_start_rot_z, 0.0f );
 
-		// Z position
-		particle->m_pos_z = m_pos_z;
-		if( m_pos_z_rand > 0.0f )
-		{
-			particle->m_pos_z += Get_Random_Float( 0.0f, m_pos_z_rand );
-		}
+	// direction angle and speed are stored in the velocity until converted
+	float *vel_x = &m_particles.m_vel_x[first];
+	float *vel_y = &m_particles.m_vel_y[first];
+	float *rot_z = &m_particles.m_rot_z[first];
+	Emit_Particle_Values( random, vel_x, count, m_angle_start, m_angle_range );
+	Emit_Particle_Values( random, vel_y, count, m_vel, m_vel_rand );
 
-		// angle range
-		float dir_angle = m_angle_start;
-		// start angle
-		if( m_angle_range > 0.0f )
-		{
-			dir_angle += Get_Random_Float( 0.0f, m_angle_range );
-		}
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		const float dir_angle = vel_x[i];
+		const float speed = vel_y[i];
 
-		// Velocity
-		float speed = m_vel;
-		if( m_vel_rand > 0.0f )
+		// Start direction is added to the z rotation
+		if( m_start_rot_z_uses_direction )
 		{
-			speed += Get_Random_Float( 0.0f, m_vel_rand );
+			rot_z[i] += dir_angle;
 		}
+
 		// Set Velocity
-		particle->Set_Velocity_From_Angle( dir_angle, speed, 1 );
+		vel_x[i] = cos( dir_angle * deg_to_rad ) * speed;
+		vel_y[i] = sin( dir_angle * deg_to_rad ) * speed;
+	}
 
-		// Start rotation
-		particle->m_rot_x = m_start_rot_x;
-		particle->m_rot_y = m_start_rot_y;
-		particle->m_rot_z = m_start_rot_z;
+	// Constant rotation
+	Emit_Particle_Values( random, &m_particles.m_const_rot_x[first], count, m_const_rot_x, m_const_rot_x_rand );
+	Emit_Particle_Values( random, &m_particles.m_const_rot_y[first], count, m_const_rot_y, m_const_rot_y_rand );
+	Emit_Particle_Values( random, &m_particles.m_const_rot_z[first], count, m_const_rot_z, m_const_rot_z_rand );
 
-		// Start direction is added to the z rotation
-		if( m_start_rot_z_uses_direction )
-		{
-			particle->m_rot_z += dir_angle;
-		}
+	// Scale
+	float *scale = &m_particles.m_scale[first];
+	Emit_Particle_Values( random, scale, count, m_size_scale, m_size_scale_rand );
 
-		// Constant rotation
-		particle->m_const_rot_x = m_const_rot_x;
-		particle->m_const_rot_y = m_const_rot_y;
-		particle->m_const_rot_z = m_const_rot_z;
-		if( m_const_rot_x_rand > 0.0f )
-		{
-			particle->m_const_rot_x += Get_Random_Float( 0.0f, m_const_rot_x_rand );
-		}
-		if( m_const_rot_y_rand > 0.0f )
-		{
-			particle->m_const_rot_y += Get_Random_Float( 0.0f, m_const_rot_y_rand );
-		}
-		if( m_const_rot_z_rand > 0.0f )
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		// invalid scale is ignored like in cSprite::Set_Scale
+		if( Is_Float_Equal( scale[i], 0.0f ) )
 		{
-			particle->m_const_rot_z += Get_Random_Float( 0.0f, m_const_rot_z_rand );
+			scale[i] = 1.0f;
 		}
+	}
 
-		// Scale
-		float scale = m_size_scale;
-		if( m_size_scale_rand > 0.0f )
-		{
-			scale += Get_Random_Float( 0.0f, m_size_scale_rand );
-		}
-		particle->Set_Scale( scale, 1 );
+	std::copy( scale, scale + count, &m_particles.m_start_scale[first] );
 
-		// Gravity
-		float grav_x = m_gravity_x;
-		if( m_gravity_x_rand > 0.0f )
-		{
-			grav_x += Get_Random_Float( 0.0f, m_gravity_x_rand );
-		}
-		float grav_y = m_gravity_y;
-		if( m_gravity_y_rand > 0.0f )
-		{
-			grav_y += Get_Random_Float( 0.0f, m_gravity_y_rand );
-		}
-		// set Gravity
-		particle->Set_Gravity( grav_x, grav_y );
+	// Gravity
+	Emit_Particle_Values( random, &m_particles.m_gravity_x[first], count, m_gravity_x, m_gravity_x_rand );
+	Emit_Particle_Values( random, &m_particles.m_gravity_y[first], count, m_gravity_y, m_gravity_y_rand );
+
+	// Time to live
+	Emit_Particle_Values( random, &m_particles.m_time_to_live[first], count, m_time_to_live, m_time_to_live_rand );
+
+	// Color
+	for( unsigned int i = first; i < first + count; i++ )
+	{
+		Color &color = m_particles.m_color[i];
+		color = m_color;
 
-		// Color
-		particle->Set_Color( m_color );
 		if( m_color_rand.red > 0 )
 		{
-			particle->m_color.red += rand() % m_color_rand.red;
+			color.red += random.Get_Int( m_color_rand.red );
 		}
 		if( m_color_rand.green > 0 )
 		{
-			particle->m_color.green += rand() % m_color_rand.green;
+			color.green += random.Get_Int( m_color_rand.green );
 		}
 		if( m_color_rand.blue > 0 )
 		{
-			particle->m_color.blue += rand() % m_color_rand.blue;
+			color.blue += random.Get_Int( m_color_rand.blue );
 		}
 		if( m_color_rand.alpha > 0 )
 		{
-			particle->m_color.alpha += rand() % m_color_rand.alpha;
-		}
-
-		// Time to life
-		particle->m_time_to_live = m_time_to_live;
-		if( m_time_to_live_rand > 0.0f )
-		{
-			particle->m_time_to_live += Get_Random_Float( 0.0f, m_time_to_live_rand );
+			color.alpha += random.Get_Int( m_color_rand.alpha );
 		}
-
-		m_objects.push_back( particle );
 	}
 }
 
 void cParticle_Emitter :: Clear( bool reset /* = 1 */ )
 {
 	// clear particles
-	for( ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr )
-	{
-		delete *itr;
-	}
-
-	m_objects.clear();
+	m_particles.Clear();
 
 	// clear animation data
 	m_emit_counter = 0.0f;
@@ -946,28 +974,72 @@ void cParticle_Emitter :: Update( void )
 
 void cParticle_Emitter :: Update_Particles( void )
 {
-	// update objects
-	for( ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); )
+	const unsigned int count = m_particles.size();
+	const float speed_factor = pFramerate->m_speed_factor;
+	const float fade_step = ( static_cast<float>(speedfactor_fps) * 0.001f ) * speed_factor;
+
+	// update fade modifier
+	float *fade_pos = count ? &m_particles.m_fade_pos[0] : NULL;
+	const float *time_to_live = count ? &m_particles.m_time_to_live[0] : NULL;
+
+	for( unsigned int i = 0; i < count; i++ )
 	{
-		// get object pointer
-		cParticle *obj = (*itr);
+		fade_pos[i] -= fade_step / time_to_live[i];
+	}
 
-		// update
-		obj->Update();
+	// with size fading
+	if( m_fade_size )
+	{
+		float *scale = count ? &m_particles.m_scale[0] : NULL;
+		const float *start_scale = count ? &m_particles.m_start_scale[0] : NULL;
 
-		// if finished
-		if( !obj->m_active )
+		for( unsigned int i = 0; i < count; i++ )
 		{
-			itr = m_objects.erase( itr );
-			delete obj;
+			// finished particles keep their last scale
+			if( fade_pos[i] > 0.0f )
+			{
+				scale[i] = start_scale[i] * fade_pos[i];
+			}
 		}
-		// increment
-		else
+	}
+
+	// move
+	if( count )
+	{
+		float *pos_x = &m_particles.m_pos_x[0];
+		float *pos_y = &m_particles.m_pos_y[0];
+		float *vel_x = &m_particles.m_vel_x[0];
+		float *vel_y = &m_particles.m_vel_y[0];
+		const float *gravity_x = &m_particles.m_gravity_x[0];
+		const float *gravity_y = &m_particles.m_gravity_y[0];
+
+		for( unsigned int i = 0; i < count; i++ )
 		{
-			++itr;
+			pos_x[i] += vel_x[i] * speed_factor;
+			pos_y[i] += vel_y[i] * speed_factor;
+			// todo : gravity maximum
+			vel_x[i] += gravity_x[i] * speed_factor;
+			vel_y[i] += gravity_y[i] * speed_factor;
 		}
 	}
 
+	// constant rotation
+	if( !Is_Float_Equal( m_const_rot_x, 0.0f ) || m_const_rot_x_rand > 0.0f )
+	{
+		Update_Particles_Rotation( m_particles.m_rot_x, m_particles.m_const_rot_x );
+	}
+	if( !Is_Float_Equal( m_const_rot_y, 0.0f ) || m_const_rot_y_rand > 0.0f )
+	{
+		Update_Particles_Rotation( m_particles.m_rot_y, m_particles.m_const_rot_y );
+	}
+	if( !Is_Float_Equal( m_const_rot_z, 0.0f ) || m_const_rot_z_rand > 0.0f )
+	{
+		Update_Particles_Rotation( m_particles.m_rot_z, m_particles.m_const_rot_z );
+	}
+
+	// remove finished particles
+	m_particles.Remove_Finished();
+
 	// if able to emit or endless emitter
 	if( m_emitter_living_time < m_emitter_time_to_live || Is_Float_Equal( m_emitter_time_to_live, -1.0f ) )
 	{
@@ -981,12 +1053,27 @@ void cParticle_Emitter :: Update_Particles( void )
 		m_emit_counter += pFramerate->m_speed_factor * ( static_cast<float>(speedfactor_fps) * 0.001f );
 	}
 	// no particles are active
-	else if( m_objects.empty() )
+	else if( m_particles.empty() )
 	{
 		Set_Active( 0 );
 	}
 }
 
+void cParticle_Emitter :: Update_Particles_Rotation( vector<float> &rot, const vector<float> &const_rot ) const
+{
+	const float speed_factor = pFramerate->m_speed_factor;
+
+	for( unsigned int i = 0; i < rot.size(); i++ )
+	{
+		if( Is_Float_Equal( const_rot[i], 0.0f ) )
+		{
+			continue;
+		}
+
+		rot[i] = fmod( rot[i] + ( const_rot[i] * speed_factor ), 360.0f );
+	}
+}
+
 void cParticle_Emitter :: Update_Position( void )
 {
 	if( m_emitter_based_on_camera_pos && !editor_enabled )
@@ -1031,9 +1118,9 @@ void cParticle_Emitter :: Draw( cSurface_Request *request /* = NULL */ )
 		return;
 	}
 
-	for( ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr )
+	if( m_image && !m_particles.empty() )
 	{
-		(*itr)->Draw();
+		Draw_Particles();
 	}
 
 	if( editor_enabled )
@@ -1067,38 +1154,147 @@ void cParticle_Emitter :: Draw( cSurface_Request *request /* = NULL */ )
 	}
 }
 
-void cParticle_Emitter :: Keep_Particles_In_Rect( const GL_rect &clip_rect, ParticleClipMode mode /* = PCM_MOVE */ )
+void cParticle_Emitter :: Draw_Particles( void ) const
 {
-	// temporary obj rect
-	GL_rect obj_rect;
+	const unsigned int count = m_particles.size();
 
-	// find particles that are not visible and move them to the opposite screen side
-	for( ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr )
+	cSurface_Batch_Request *request = new cSurface_Batch_Request();
+
+	// texture
+	request->m_texture_id = m_image->m_image;
+	request->m_w = m_image->m_start_w;
+	request->m_h = m_image->m_start_h;
+	// no camera setting
+	request->m_no_camera = m_no_camera;
+
+	// blending
+	if( m_blending == BLEND_ADD )
 	{
-		// get animation particle pointer
-		cParticle *obj = static_cast<cParticle *>(*itr);
+		request->m_blend_sfactor = GL_SRC_ALPHA;
+		request->m_blend_dfactor = GL_ONE;
+	}
+	else if( m_blending == BLEND_DRIVE )
+	{
+		request->m_blend_sfactor = GL_SRC_COLOR;
+		request->m_blend_dfactor = GL_DST_ALPHA;
+	}
 
-		// set rectangle
-		if( obj->m_scale_x != 1.0f )
+	// based on emitter position
+	float offset_x = 0.0f;
+	float offset_y = 0.0f;
+
+	if( m_particle_based_on_emitter_pos > 0.0f )
+	{
+		offset_x = m_pos_x * m_particle_based_on_emitter_pos;
+		offset_y = m_pos_y * m_particle_based_on_emitter_pos;
+	}
+
+	request->m_items.reserve( count );
+
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		const float fade_pos = m_particles.m_fade_pos[i];
+
+		// removed by the clip rect
+		if( fade_pos <= 0.0f )
 		{
-			obj_rect.m_x = obj->m_pos_x - ( ( obj->m_image->m_w * 0.5f ) * ( obj->m_scale_x - 1.0f ) );
-			obj_rect.m_w = obj->m_rect.m_w * obj->m_scale_x;
+			continue;
 		}
-		else
+
+		const float scale = m_particles.m_scale[i];
+
+		request->m_items.push_back( cSurface_Batch_Item() );
+		cSurface_Batch_Item &item = request->m_items.back();
+
+		// position with centered scaling
+		item.m_pos_x = m_particles.m_pos_x[i] + ( m_image->m_int_x * scale ) + offset_x;
+		item.m_pos_y = m_particles.m_pos_y[i] + ( m_image->m_int_y * scale ) + offset_y;
+
+		if( scale != 1.0f )
+		{
+			item.m_pos_x -= ( m_image->m_w * 0.5f ) * ( scale - 1.0f );
+			item.m_pos_y -= ( m_image->m_h * 0.5f ) * ( scale - 1.0f );
+		}
+
+		item.m_pos_z = m_particles.m_pos_z[i];
+		item.m_scale_x = scale;
+		item.m_scale_y = scale;
+
+		// rotation
+		item.m_rot_x = m_particles.m_rot_x[i] + m_image->m_base_rot_x;
+		item.m_rot_y = m_particles.m_rot_y[i] + m_image->m_base_rot_y;
+		item.m_rot_z = m_particles.m_rot_z[i] + m_image->m_base_rot_z;
+
+		// color
+		item.m_color = m_particles.m_color[i];
+
+		// color fading
+		if( m_fade_color )
 		{
-			obj_rect.m_x = obj->m_pos_x;
-			obj_rect.m_w = obj->m_rect.m_w;
+			item.m_color.red = static_cast<Uint8>(item.m_color.red * fade_pos);
+			item.m_color.green = static_cast<Uint8>(item.m_color.green * fade_pos);
+			item.m_color.blue = static_cast<Uint8>(item.m_color.blue * fade_pos);
 		}
 
-		if( obj->m_scale_y != 1.0f )
+		// alpha fading
+		if( m_fade_alpha )
 		{
-			obj_rect.m_y = obj->m_pos_y - ( ( obj->m_image->m_h * 0.5f ) * ( obj->m_scale_y - 1.0f ) );
-			obj_rect.m_h = obj->m_rect.m_h * obj->m_scale_y;
+			item.m_color.alpha = static_cast<Uint8>(item.m_color.alpha * fade_pos);
 		}
-		else
+	}
+
+	if( request->m_items.empty() )
+	{
+		delete request;
+		return;
+	}
+
+	// particles with a random z position are drawn in z order
+	if( m_pos_z_rand > 0.0f )
+	{
+		std::stable_sort( request->m_items.begin(), request->m_items.end(), cSurface_Batch_Request::zpos_sort() );
+	}
+
+	/* the batch is sorted with the lowest particle
+	 * the render queue draws the other particles between the other requests with their own z position
+	*/
+	request->m_pos_z = request->m_items.front().m_pos_z;
+
+	// add request
+	pRenderer->Add( request );
+}
+
+void cParticle_Emitter :: Keep_Particles_In_Rect( const GL_rect &clip_rect, ParticleClipMode mode /* = PCM_MOVE */ )
+{
+	if( !m_image )
+	{
+		return;
+	}
+
+	const unsigned int count = m_particles.size();
+	// particle image size
+	const float image_w = m_image->m_w;
+	const float image_h = m_image->m_h;
+
+	// find particles that are not visible and move them to the opposite screen side
+	for( unsigned int i = 0; i < count; i++ )
+	{
+		float &pos_x = m_particles.m_pos_x[i];
+		float &pos_y = m_particles.m_pos_y[i];
+		float &vel_x = m_particles.m_vel_x[i];
+		float &vel_y = m_particles.m_vel_y[i];
+		const float scale = m_particles.m_scale[i];
+
+		// temporary obj rect
+		GL_rect obj_rect( pos_x, pos_y, image_w, image_h );
+
+		// set rectangle
+		if( scale != 1.0f )
 		{
-			obj_rect.m_y = obj->m_pos_y;
-			obj_rect.m_h = obj->m_rect.m_h;
+			obj_rect.m_x -= ( image_w * 0.5f ) * ( scale - 1.0f );
+			obj_rect.m_y -= ( image_h * 0.5f ) * ( scale - 1.0f );
+			obj_rect.m_w *= scale;
+			obj_rect.m_h *= scale;
 		}
 
 		// out in left
@@ -1107,18 +1303,18 @@ void cParticle_Emitter :: Keep_Particles_In_Rect( const GL_rect &clip_rect, Part
 			// move to right
 			if( mode == PCM_MOVE )
 			{
-				obj->Move( clip_rect.m_w + obj_rect.m_w - 1.0f, 0, 1 );
+				pos_x += clip_rect.m_w + obj_rect.m_w - 1.0f;
 			}
 			else if( mode == PCM_REVERSE )
 			{
-				if( obj->m_velx < 0.0f )
+				if( vel_x < 0.0f )
 				{
-					obj->Set_Velocity( -obj->m_velx, obj->m_vely );
+					vel_x = -vel_x;
 				}
 			}
 			else if( mode == PCM_DELETE )
 			{
-				obj->Set_Active( 0 );
+				m_particles.m_fade_pos[i] = 0.0f;
 			}
 		}
 		// out in right
@@ -1127,18 +1323,18 @@ void cParticle_Emitter :: Keep_Particles_In_Rect( const GL_rect &clip_rect, Part
 			// move to left
 			if( mode == PCM_MOVE )
 			{
-				obj->Move( -clip_rect.m_w - obj_rect.m_w + 1.0f, 0, 1 );
+				pos_x += -clip_rect.m_w - obj_rect.m_w + 1.0f;
 			}
 			else if( mode == PCM_REVERSE )
 			{
-				if( obj->m_velx > 0.0f )
+				if( vel_x > 0.0f )
 				{
-					obj->Set_Velocity( -obj->m_velx, obj->m_vely );
+					vel_x = -vel_x;
 				}
 			}
 			else if( mode == PCM_DELETE )
 			{
-				obj->Set_Active( 0 );
+				m_particles.m_fade_pos[i] = 0.0f;
 			}
 		}
 		// out on top
@@ -1147,18 +1343,18 @@ void cParticle_Emitter :: Keep_Particles_In_Rect( const GL_rect &clip_rect, Part
 			// move to bottom
 			if( mode == PCM_MOVE )
 			{
-				obj->Move( 0, clip_rect.m_h + obj_rect.m_h - 1.0f, 1 );
+				pos_y += clip_rect.m_h + obj_rect.m_h - 1.0f;
 			}
 			else if( mode == PCM_REVERSE )
 			{
-				if( obj->m_vely < 0.0f )
+				if( vel_y < 0.0f )
 				{
-					obj->Set_Velocity( obj->m_velx, -obj->m_vely );
+					vel_y = -vel_y;
 				}
 			}
 			else if( mode == PCM_DELETE )
 			{
-				obj->Set_Active( 0 );
+				m_particles.m_fade_pos[i] = 0.0f;
 			}
 		}
 		// out on bottom
@@ -1167,18 +1363,18 @@ void cParticle_Emitter :: Keep_Particles_In_Rect( const GL_rect &clip_rect, Part
 			// move to top
 			if( mode == PCM_MOVE )
 			{
-				obj->Move( 0, -clip_rect.m_h - obj_rect.m_h + 1.0f, 1 );
+				pos_y += -clip_rect.m_h - obj_rect.m_h + 1.0f;
 			}
 			else if( mode == PCM_REVERSE )
 			{
-				if( obj->m_vely > 0.0f )
+				if( vel_y > 0.0f )
 				{
-					obj->Set_Velocity( obj->m_velx, -obj->m_vely );
+					vel_y = -vel_y;
 				}
 			}
 			else if( mode == PCM_DELETE )
 			{
-				obj->Set_Active( 0 );
+				m_particles.m_fade_pos[i] = 0.0f;
 			}
 		}
 	}
@@ -1315,6 +1511,8 @@ void cParticle_Emitter :: Set_Emitter_Rect( float x, float y, float w /* = 0 */,
 	m_col_rect.m_h = m_rect.m_h;
 	m_start_rect.m_w = m_rect.m_w;
 	m_start_rect.m_h = m_rect.m_h;
+
+	Update_Hot_Data();
 }
 
 void cParticle_Emitter :: Set_Emitter_Rect( const GL_rect &rect )
@@ -2213,6 +2411,8 @@ bool cParticle_Emitter :: Editor_Clip_Mode_Select( const CEGUI::EventArgs &event
 
 /* *** *** *** *** *** cAnimation_Manager *** *** *** *** *** *** *** *** *** *** *** *** */
 
+const unsigned int cAnimation_Manager::m_effect_cache_max = 200;
+
 cAnimation_Manager :: cAnimation_Manager( void )
 : cObject_Manager<cAnimation>()
 {
@@ -2222,14 +2422,19 @@ cAnimation_Manager :: cAnimation_Manager( void )
 cAnimation_Manager :: ~cAnimation_Manager( void )
 {
 	cAnimation_Manager::Delete_All();
+	Delete_Effect_Cache();
 }
 
 void cAnimation_Manager :: Update( void )
 {
-	for( cAnimation_List::iterator itr = objects.begin(); itr != objects.end(); )
+	// position of the next active object
+	unsigned int active_count = 0;
+
+	// objects added while updating are also updated
+	for( unsigned int i = 0; i < objects.size(); i++ )
 	{
 		// get object pointer
-		cAnimation *obj = (*itr);
+		cAnimation *obj = objects[i];
 
 		// update
 		obj->Update();
@@ -2237,15 +2442,28 @@ void cAnimation_Manager :: Update( void )
 		// delete if finished
 		if( !obj->m_active )
 		{
-			itr = objects.erase( itr );
-			delete obj;
+			// keep effects for reuse
+			if( obj->m_type == TYPE_PARTICLE_EMITTER && static_cast<cParticle_Emitter *>(obj)->m_effect && m_effect_cache.size() < m_effect_cache_max )
+			{
+				cParticle_Emitter *emitter = static_cast<cParticle_Emitter *>(obj);
+				emitter->Clear();
+				m_effect_cache.push_back( emitter );
+			}
+			else
+			{
+				delete obj;
+			}
 		}
-		// increment
+		// keep
 		else
 		{
-			++itr;
+			objects[active_count] = obj;
+			active_count++;
 		}
 	}
+
+	// remove finished objects
+	objects.resize( active_count );
 }
 
 void cAnimation_Manager :: Draw( void )
@@ -2269,9 +2487,250 @@ void cAnimation_Manager :: Add( cAnimation *animation )
 	cObject_Manager<cAnimation>::Add( animation );
 }
 
+cParticle_Emitter *cAnimation_Manager :: Get_Effect( unsigned int effect_id, cSprite_Manager *sprite_manager )
+{
+	cParticle_Emitter *emitter = Get_Effect_Emitter( sprite_manager );
+	const cParticle_Emitter *effect_template = pParticle_Effects->Get( effect_id );
+
+	if( effect_template )
+	{
+		emitter->Set_Settings( effect_template );
+	}
+	else
+	{
+		printf( "Warning : Particle effect template %d not found\n", effect_id );
+	}
+
+	return emitter;
+}
+
+cParticle_Emitter *cAnimation_Manager :: Get_Effect( const std::string &effect_name, cSprite_Manager *sprite_manager )
+{
+	int effect_id = pParticle_Effects->Get_Id( effect_name );
+
+	// not found
+	if( effect_id < 0 )
+	{
+		printf( "Warning : Particle effect template %s not found\n", effect_name.c_str() );
+		return Get_Effect_Emitter( sprite_manager );
+	}
+
+	return Get_Effect( static_cast<unsigned int>(effect_id), sprite_manager );
+}
+
+cParticle_Emitter *cAnimation_Manager :: Get_Effect_Emitter( cSprite_Manager *sprite_manager )
+{
+	cParticle_Emitter *emitter;
+
+	// new
+	if( m_effect_cache.empty() )
+	{
+		emitter = new cParticle_Emitter( sprite_manager );
+	}
+	// reuse a finished effect
+	else
+	{
+		emitter = m_effect_cache.back();
+		m_effect_cache.pop_back();
+		emitter->Set_Sprite_Manager( sprite_manager );
+		emitter->Init();
+	}
+
+	emitter->Set_Active( 1 );
+	emitter->m_effect = 1;
+	return emitter;
+}
+
+void cAnimation_Manager :: Delete_Effect_Cache( void )
+{
+	for( EffectList::iterator itr = m_effect_cache.begin(); itr != m_effect_cache.end(); ++itr )
+	{
+		delete *itr;
+	}
+
+	m_effect_cache.clear();
+}
+
+/* *** *** *** *** *** *** *** Particle Effect Templates *** *** *** *** *** *** *** *** *** *** */
+
+cParticle_Effect_Templates :: cParticle_Effect_Templates( void )
+{
+	
+}
+
+cParticle_Effect_Templates :: ~cParticle_Effect_Templates( void )
+{
+	Delete_All();
+}
+
+void cParticle_Effect_Templates :: Init( void )
+{
+	// enemy hit
+	cParticle_Emitter *anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
+	anim->Set_Quota( 4 );
+	anim->Set_Time_to_Live( 0.3f );
+	anim->Set_Color( Color( static_cast<Uint8>(250), 250, 150, 255 ) );
+	anim->Set_Speed( 0.5f, 2.6f );
+	anim->Set_Scale( 0.2f, 0.6f );
+	anim->Set_Direction_Range( 220, 100 );
+	anim->Set_Fading_Alpha( 1 );
+	anim->Set_Blending( BLEND_ADD );
+	Add( "enemy_hit", anim );
+
+	// standing shell hit by the player
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
+	anim->Set_Quota( 4 );
+	anim->Set_Time_to_Live( 0.3f );
+	anim->Set_Speed( 4.0f, 0.5f );
+	anim->Set_Scale( 0.6f );
+	anim->Set_Fading_Size( 1 );
+	anim->Set_Color( Color( static_cast<Uint8>(254), 200, 100 ) );
+	Add( "shell_hit", anim );
+
+	// running shell killed an enemy
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
+	anim->Set_Quota( 5 );
+	anim->Set_Time_to_Live( 0.3f );
+	anim->Set_Speed( 1.2f, 0.8f );
+	anim->Set_Scale( 0.7f );
+	anim->Set_Fading_Alpha( 1 );
+	anim->Set_Blending( BLEND_ADD );
+	Add( "shell_kill", anim );
+
+	// running shell hit a wall
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke.png" ) );
+	anim->Set_Quota( 5 );
+	anim->Set_Time_to_Live( 0.2f, 0.2f );
+	anim->Set_Speed( 1.0f, 1.0f );
+	anim->Set_Scale( 0.5f, 0.4f );
+	Add( "shell_wall_smoke", anim );
+
+	// running furball and spikeball
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke_black.png" ) );
+	anim->Set_Time_to_Live( 0.6f );
+	anim->Set_Scale( 0.2f );
+	Add( "running_smoke", anim );
+
+	// furball boss smoke
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke_grey_big.png" ) );
+	anim->Set_Const_Rotation_Z( -6.0f, 12.0f );
+	anim->Set_Time_to_Live( 1.5f );
+	anim->Set_Speed( 0.4f, 0.9f );
+	anim->Set_Color( black, Color( static_cast<Uint8>(87), 60, 40, 0 ) );
+	Add( "furball_smoke", anim );
+
+	// turtle boss stars
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/star.png" ) );
+	anim->Set_Const_Rotation_Z( -6.0f, 12.0f );
+	anim->Set_Time_to_Live( 1.0f );
+	anim->Set_Speed( 1.0f, 4.0f );
+	anim->Set_Color( orange, Color( static_cast<Uint8>(6), 60, 20, 0 ) );
+	anim->Set_Blending( BLEND_ADD );
+	Add( "turtle_boss_stars", anim );
+
+	// rokko smoke
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke_grey_big.png" ) );
+	anim->Set_Time_to_Live( 0.8f, 0.8f );
+	anim->Set_Speed( 1.0f, 0.2f );
+	anim->Set_Const_Rotation_Z( -1, 2 );
+	anim->Set_Color( Color( static_cast<Uint8>(155), 150, 130 ) );
+	anim->Set_Fading_Alpha( 1 );
+	Add( "rokko_smoke", anim );
+
+	// rokko sparks
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/light.png" ) );
+	anim->Set_Time_to_Live( 0.2f, 0.1f );
+	anim->Set_Speed( 1.2f, 1.1f );
+	anim->Set_Color( Color( static_cast<Uint8>(250), 250, 200 ), Color( static_cast<Uint8>(5), 5, 0, 0 ) );
+	anim->Set_Scale( 0.3f, 0.3f );
+	anim->Set_Fading_Size( 1 );
+	anim->Set_Fading_Alpha( 0 );
+	Add( "rokko_sparks", anim );
+
+	// gee cloud
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/cloud.png" ) );
+	anim->Set_Scale( 0.5f, 0.3f );
+	anim->Set_Time_to_Live( 2.0f );
+	anim->Set_Fading_Alpha( 1 );
+	anim->Set_Blending( BLEND_ADD );
+	Add( "gee_cloud", anim );
+
+	// thromp smoke
+	anim = new cParticle_Emitter( NULL );
+	anim->Set_Image( pVideo->Get_Surface( "animation/particles/smoke.png" ) );
+	anim->Set_Time_to_Live( 1, 1 );
+	anim->Set_Direction_Range( 180, 180 );
+	anim->Set_Speed( 0.05f, 0.4f );
+	anim->Set_Fading_Alpha( 1 );
+	anim->Set_Const_Rotation_Z( -2, 4 );
+	Add( "thromp_smoke", anim );
+}
+
+unsigned int cParticle_Effect_Templates :: Add( const std::string &name, cParticle_Emitter *emitter )
+{
+	TemplateNameMap::const_iterator itr = m_names.find( name );
+
+	// replace
+	if( itr != m_names.end() )
+	{
+		delete m_templates[itr->second];
+		m_templates[itr->second] = emitter;
+		return itr->second;
+	}
+
+	m_names[name] = m_templates.size();
+	m_templates.push_back( emitter );
+	return m_templates.size() - 1;
+}
+
+int cParticle_Effect_Templates :: Get_Id( const std::string &name ) const
+{
+	TemplateNameMap::const_iterator itr = m_names.find( name );
+
+	// not found
+	if( itr == m_names.end() )
+	{
+		return -1;
+	}
+
+	return itr->second;
+}
+
+const cParticle_Emitter *cParticle_Effect_Templates :: Get( unsigned int id ) const
+{
+	if( id >= m_templates.size() )
+	{
+		return NULL;
+	}
+
+	return m_templates[id];
+}
+
+void cParticle_Effect_Templates :: Delete_All( void )
+{
+	for( TemplateList::iterator itr = m_templates.begin(); itr != m_templates.end(); ++itr )
+	{
+		delete *itr;
+	}
+
+	m_templates.clear();
+	m_names.clear();
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 cAnimation_Manager *pActive_Animation_Manager = NULL;
+cParticle_Effect_Templates *pParticle_Effects = NULL;
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
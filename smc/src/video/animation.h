@@ -18,6 +18,7 @@
 
 #include "../objects/animated_sprite.h"
 #include "../core/obj_manager.h"
+#include <boost/unordered_map.hpp>
 
 namespace SMC
 {
@@ -74,6 +75,10 @@ public:
 	cAnimation_Goldpiece( cSprite_Manager *sprite_manager, float posx, float posy, float height = 40.0f, float width = 20.0f );
 	virtual ~cAnimation_Goldpiece( void );
 
+	// allocated from a memory pool as many are created and deleted
+	static void *operator new( size_t size );
+	static void operator delete( void *ptr, size_t size );
+
 	// update
 	virtual void Update( void );
 	// draw
@@ -96,6 +101,10 @@ public:
 
 	virtual ~cAnimation_Fireball_Item( void ) {}
 
+	// allocated from a memory pool as many are created and deleted
+	static void *operator new( size_t size );
+	static void operator delete( void *ptr, size_t size );
+
 	// lifetime
 	float m_counter;
 };
@@ -106,6 +115,10 @@ public:
 	cAnimation_Fireball( cSprite_Manager *sprite_manager, float posx, float posy, unsigned int power = 5 );
 	virtual ~cAnimation_Fireball( void );
 
+	// allocated from a memory pool as many are created and deleted
+	static void *operator new( size_t size );
+	static void operator delete( void *ptr, size_t size );
+
 	// update
 	virtual void Update( void );
 	// draw
@@ -115,40 +128,64 @@ public:
 	FireAnimList m_objects;
 };
 
-/* *** *** *** *** *** *** *** Particle Emitter item *** *** *** *** *** *** *** *** *** *** */
+/* *** *** *** *** *** *** *** Particle Pool *** *** *** *** *** *** *** *** *** *** */
 
-// forward declare
-class cParticle_Emitter;
-
-// Particle Item
-class cParticle : public cMovingSprite
+/* Particle data of an emitter stored as parallel arrays
+ * the update loops only touch the arrays they need
+*/
+class cParticle_Pool
 {
 public:
-	cParticle( cParticle_Emitter *parent );
-	virtual ~cParticle( void );
+	cParticle_Pool( void );
+	~cParticle_Pool( void );
 
-	// update
-	virtual void Update( void );
-	// draw
-	virtual void Draw( cSurface_Request *request = NULL );
+	// Add particles with default values and return the index of the first
+	unsigned int Add( unsigned int count = 1 );
+	/* Remove all particles with a fade position of zero or less
+	 * keeps the order of the remaining particles
+	*/
+	void Remove_Finished( void );
+	// Remove all particles
+	void Clear( void );
 
-	// set gravity
-	void Set_Gravity( float x, float y );
+	// Return the particle count
+	inline unsigned int size( void ) const
+	{
+		return m_pos_x.size();
+	}
+	// Return true if no particles
+	inline bool empty( void ) const
+	{
+		return m_pos_x.empty();
+	}
 
-	// parent particle emitter
-	cParticle_Emitter *m_parent;
-	// time to live
-	float m_time_to_live;
+	// position
+	vector<float> m_pos_x;
+	vector<float> m_pos_y;
+	vector<float> m_pos_z;
+	// velocity
+	vector<float> m_vel_x;
+	vector<float> m_vel_y;
+	// gravity
+	vector<float> m_gravity_x;
+	vector<float> m_gravity_y;
+	// rotation
+	vector<float> m_rot_x;
+	vector<float> m_rot_y;
+	vector<float> m_rot_z;
 	// constant rotation
-	float m_const_rot_x;
-	float m_const_rot_y;
-	float m_const_rot_z;
-	// particle gravity
-	float m_gravity_x;
-	float m_gravity_y;
-
+	vector<float> m_const_rot_x;
+	vector<float> m_const_rot_y;
+	vector<float> m_const_rot_z;
+	// scale
+	vector<float> m_scale;
+	vector<float> m_start_scale;
+	// time to live
+	vector<float> m_time_to_live;
 	// fading position value
-	float m_fade_pos;
+	vector<float> m_fade_pos;
+	// color
+	vector<Color> m_color;
 };
 
 /* *** *** *** *** *** *** *** Particle Emitter *** *** *** *** *** *** *** *** *** *** */
@@ -176,6 +213,8 @@ public:
 	virtual void Init( void );
 	// copy
 	virtual cParticle_Emitter *Copy( void ) const;
+	// Set all emitter settings from the given emitter
+	void Set_Settings( const cParticle_Emitter *emitter );
 
 	// load from stream
 	virtual void Load_From_XML( CEGUI::XMLAttributes &attributes );
@@ -195,10 +234,14 @@ public:
 	 * does not update emitter living time
 	*/
 	void Update_Particles( void );
+	// add the constant rotation to the particle rotation
+	void Update_Particles_Rotation( vector<float> &rot, const vector<float> &const_rot ) const;
 	// update position and clipping
 	void Update_Position( void );
 	// Draw everything
 	virtual void Draw( cSurface_Request *request = NULL );
+	// Draw all particles with one batch request
+	void Draw_Particles( void ) const;
 
 	// keep particles in the given rectangle
 	void Keep_Particles_In_Rect( const GL_rect &clip_rect, ParticleClipMode mode = PCM_MOVE );
@@ -310,8 +353,7 @@ public:
 	bool Editor_Clip_Mode_Select( const CEGUI::EventArgs &event );
 
 	// Particle items
-	typedef vector<cParticle *> ParticleList;
-	ParticleList m_objects;
+	cParticle_Pool m_particles;
 
 	// filename of the particle
 	std::string m_image_filename;
@@ -364,6 +406,9 @@ public:
 	// clip mode
 	ParticleClipMode m_clip_mode;
 
+	// if this is a one-shot effect which is kept for reuse by the animation manager when finished
+	bool m_effect;
+
 private:
 	// time alive
 	float m_emitter_living_time;
@@ -371,6 +416,57 @@ private:
 	float m_emit_counter;
 };
 
+/* *** *** *** *** *** *** *** Particle Effect Templates *** *** *** *** *** *** *** *** *** *** */
+
+// Particle effect template identifiers in the order cParticle_Effect_Templates::Init adds them
+enum ParticleEffect
+{
+	PARTICLE_EFFECT_ENEMY_HIT = 0,
+	PARTICLE_EFFECT_SHELL_HIT = 1,
+	PARTICLE_EFFECT_SHELL_KILL = 2,
+	PARTICLE_EFFECT_SHELL_WALL_SMOKE = 3,
+	PARTICLE_EFFECT_RUNNING_SMOKE = 4,
+	PARTICLE_EFFECT_FURBALL_SMOKE = 5,
+	PARTICLE_EFFECT_TURTLE_BOSS_STARS = 6,
+	PARTICLE_EFFECT_ROKKO_SMOKE = 7,
+	PARTICLE_EFFECT_ROKKO_SPARKS = 8,
+	PARTICLE_EFFECT_GEE_CLOUD = 9,
+	PARTICLE_EFFECT_THROMP_SMOKE = 10
+};
+
+/* Named particle emitter settings configured once
+ * one-shot effects are created from them with cAnimation_Manager::Get_Effect
+*/
+class cParticle_Effect_Templates
+{
+public:
+	cParticle_Effect_Templates( void );
+	~cParticle_Effect_Templates( void );
+
+	// Add the default effects with the ParticleEffect identifiers
+	void Init( void );
+
+	/* Add the emitter as named template and return its identifier
+	 * replaces an existing template with the same name
+	 * the emitter is deleted with the templates
+	*/
+	unsigned int Add( const std::string &name, cParticle_Emitter *emitter );
+	// Return the identifier of the named template or -1 if not available
+	int Get_Id( const std::string &name ) const;
+	// Return the template or NULL if not available
+	const cParticle_Emitter *Get( unsigned int id ) const;
+
+	// Delete all templates
+	void Delete_All( void );
+
+private:
+	typedef vector<cParticle_Emitter *> TemplateList;
+	TemplateList m_templates;
+	// template identifier by name
+	typedef boost::unordered_map<std::string, unsigned int> TemplateNameMap;
+	TemplateNameMap m_names;
+};
+
 /* *** *** *** *** *** *** *** Animation Manager *** *** *** *** *** *** *** *** *** *** */
 
 class cAnimation_Manager : public cObject_Manager<cAnimation>
@@ -382,18 +478,41 @@ public:
 	// Add an animation object with the given settings
 	virtual void Add( cAnimation *animation );
 
-	// Update the objects
+	/* Return a one-shot particle emitter with the settings of the effect template
+	 * emitters of finished effects are reused together with their particle memory
+	 * change the settings if needed and then Emit and Add it
+	*/
+	cParticle_Emitter *Get_Effect( unsigned int effect_id, cSprite_Manager *sprite_manager );
+	cParticle_Emitter *Get_Effect( const std::string &effect_name, cSprite_Manager *sprite_manager );
+	// Delete the finished effects kept for reuse
+	void Delete_Effect_Cache( void );
+
+	/* Update the objects
+	 * finished objects are removed in one pass keeping the order of the others
+	*/
 	void Update( void );
 	// Draw the objects
 	void Draw( void );
 
 	typedef vector<cAnimation *> cAnimation_List;
+
+private:
+	// Return a new or reused effect emitter without settings
+	cParticle_Emitter *Get_Effect_Emitter( cSprite_Manager *sprite_manager );
+
+	typedef vector<cParticle_Emitter *> EffectList;
+	// finished effects kept for reuse
+	EffectList m_effect_cache;
+	// maximum finished effects kept for reuse
+	static const unsigned int m_effect_cache_max;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 // The Animation Manager
 extern cAnimation_Manager *pActive_Animation_Manager;
+// The particle effect templates
+extern cParticle_Effect_Templates *pParticle_Effects;
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
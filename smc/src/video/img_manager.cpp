@@ -15,6 +15,7 @@
 
 #include "../video/img_manager.h"
 #include "../video/renderer.h"
+#include "../video/img_settings.h"
 #include "../core/i18n.h"
 // CEGUI
 #include "CEGUIWindowManager.h"
@@ -124,6 +125,12 @@ void cImage_Manager :: Grab_Textures( bool from_file /* = 0 */, bool draw_gui /*
 		Loading_Screen_Draw_Text( _("Saving Textures") );
 	}
 
+	// settings files are parsed again as they could have been changed
+	if( from_file )
+	{
+		pSettingsParser->Clear_Cache();
+	}
+
 	unsigned int loaded_files = 0;
 	unsigned int file_count = objects.size();
 
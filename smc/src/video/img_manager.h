@@ -89,6 +89,7 @@ public:
 
 	/* Save hardware textures in software memory
 	 * from_file: if set don't store in software memory but load again from file
+	 * and clear the image settings cache
 	 * draw_gui : if set use the loading screen gui for drawing
 	*/
 	void Grab_Textures( bool from_file = 0, bool draw_gui = 0  );
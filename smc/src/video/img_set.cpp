@@ -0,0 +1,113 @@
+/***************************************************************************
+ * img_set.cpp  -  shared sprite frame images
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/img_set.h"
+#include "../video/video.h"
+#include "../core/filesystem/filesystem.h"
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** cImage_Set *** *** *** *** *** *** *** *** *** *** *** */
+
+cImage_Set :: cImage_Set( void )
+{
+	m_valid = 0;
+}
+
+cImage_Set :: ~cImage_Set( void )
+{
+	
+}
+
+/* *** *** *** *** *** *** cImage_Set_Manager *** *** *** *** *** *** *** *** *** *** *** */
+
+cImage_Set_Manager :: cImage_Set_Manager( void )
+{
+	
+}
+
+cImage_Set_Manager :: ~cImage_Set_Manager( void )
+{
+	Delete_All();
+}
+
+const cImage_Set *cImage_Set_Manager :: Get( int type, const std::string &path, const char *const *frames )
+{
+	unsigned int frame_count = 0;
+
+	while( frames[frame_count] )
+	{
+		frame_count++;
+	}
+
+	const ImageSetKey key( std::make_pair( type, frame_count ), path );
+	ImageSetMap::const_iterator itr = m_sets.find( key );
+
+	// already resolved
+	if( itr != m_sets.end() )
+	{
+		return itr->second;
+	}
+
+	if( !frame_count )
+	{
+		return &m_invalid_set;
+	}
+
+	// the first frame must exist as image or settings file
+	std::string filename = DATA_DIR "/" GAME_PIXMAPS_DIR "/" + path + frames[0];
+	bool valid = File_Exists( filename );
+
+	if( !valid && filename.rfind( ".png" ) == filename.length() - 4 )
+	{
+		filename.replace( filename.length() - 4, 4, ".settings" );
+		valid = File_Exists( filename );
+	}
+
+	if( !valid )
+	{
+		return &m_invalid_set;
+	}
+
+	cImage_Set *image_set = new cImage_Set();
+	image_set->m_valid = 1;
+
+	for( unsigned int i = 0; i < frame_count; i++ )
+	{
+		image_set->m_images.push_back( pVideo->Get_Surface( path + frames[i] ) );
+	}
+
+	m_sets[key] = image_set;
+	return image_set;
+}
+
+void cImage_Set_Manager :: Delete_All( void )
+{
+	for( ImageSetMap::iterator itr = m_sets.begin(); itr != m_sets.end(); ++itr )
+	{
+		delete itr->second;
+	}
+
+	m_sets.clear();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cImage_Set_Manager *pImage_Set_Manager = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
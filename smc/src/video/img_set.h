@@ -0,0 +1,81 @@
+/***************************************************************************
+ * img_set.h
+ *
+ * Copyright (C) 2011 Florian Richter
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+   
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SMC_IMG_SET_H
+#define SMC_IMG_SET_H
+
+#include "../core/global_basic.h"
+#include "../video/gl_surface.h"
+#include <boost/unordered_map.hpp>
+
+namespace SMC
+{
+
+/* *** *** *** *** *** *** cImage_Set *** *** *** *** *** *** *** *** *** *** *** */
+
+// Resolved frame images of a sprite type
+class cImage_Set
+{
+public:
+	cImage_Set( void );
+	~cImage_Set( void );
+
+	// frame images in the given order or empty if not valid
+	vector<cGL_Surface *> m_images;
+	// if the first frame exists as image or settings file
+	bool m_valid;
+};
+
+/* *** *** *** *** *** *** cImage_Set_Manager *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Resolves the frame images of each sprite type and image path only once
+ * the returned sets are shared and must not be modified
+*/
+class cImage_Set_Manager
+{
+public:
+	cImage_Set_Manager( void );
+	~cImage_Set_Manager( void );
+
+	/* Return the image set of the sprite type and image path
+	 * path : image path prefix relative to the pixmaps directory which is prepended to each frame
+	 * frames : NULL terminated frame filenames
+	 * the frames must always be the same for the type, path and frame count
+	 * invalid sets are not kept and are checked again on the next call
+	*/
+	const cImage_Set *Get( int type, const std::string &path, const char *const *frames );
+
+	// Delete all image sets
+	void Delete_All( void );
+
+private:
+	// sprite type and frame count with the image path
+	typedef std::pair<std::pair<int, unsigned int>, std::string> ImageSetKey;
+	typedef boost::unordered_map<ImageSetKey, cImage_Set *> ImageSetMap;
+	ImageSetMap m_sets;
+	// returned for invalid sets
+	cImage_Set m_invalid_set;
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Image set manager
+extern cImage_Set_Manager *pImage_Set_Manager;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace SMC
+
+#endif
@@ -260,14 +260,73 @@ cImage_Settings_Parser :: cImage_Settings_Parser( void )
 {
 	m_settings_temp = NULL;
 	m_load_base = 1;
+	m_cache_parser = this;
 }
 
 cImage_Settings_Parser :: ~cImage_Settings_Parser( void )
 {
-	//
+	Clear_Cache();
 }
 
 cImage_Settings_Data *cImage_Settings_Parser :: Get( const std::string &filename, bool load_base_settings /* = 1 */ )
+{
+	const cImage_Settings_Data *settings = Get_Cached( filename, load_base_settings );
+
+	// not found
+	if( !settings )
+	{
+		return NULL;
+	}
+
+	return new cImage_Settings_Data( *settings );
+}
+
+const cImage_Settings_Data *cImage_Settings_Parser :: Get_Cached( const std::string &filename, bool load_base_settings /* = 1 */ )
+{
+	SettingsCache &cache = m_cache[load_base_settings];
+	SettingsCache::const_iterator itr = cache.find( filename );
+
+	// already parsed
+	if( itr != cache.end() )
+	{
+		return itr->second;
+	}
+
+	cImage_Settings_Data *settings = NULL;
+
+	if( File_Exists( filename ) )
+	{
+		// this parser is busy with the file using it as base
+		if( m_settings_temp )
+		{
+			cImage_Settings_Parser temp_parser;
+			temp_parser.m_cache_parser = this;
+			settings = temp_parser.Parse_Settings( filename, load_base_settings );
+		}
+		else
+		{
+			settings = Parse_Settings( filename, load_base_settings );
+		}
+	}
+
+	cache[filename] = settings;
+	return settings;
+}
+
+void cImage_Settings_Parser :: Clear_Cache( void )
+{
+	for( unsigned int i = 0; i < 2; i++ )
+	{
+		for( SettingsCache::iterator itr = m_cache[i].begin(); itr != m_cache[i].end(); ++itr )
+		{
+			delete itr->second;
+		}
+
+		m_cache[i].clear();
+	}
+}
+
+cImage_Settings_Data *cImage_Settings_Parser :: Parse_Settings( const std::string &filename, bool load_base_settings )
 {
 	m_load_base = load_base_settings;
 	m_settings_temp = new cImage_Settings_Data();
@@ -278,9 +337,9 @@ cImage_Settings_Data *cImage_Settings_Parser :: Get( const std::string &filename
 	return settings;
 }
 
-bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned int count, unsigned int line )
+bool cImage_Settings_Parser :: HandleMessage( const cFile_Token *parts, unsigned int count, unsigned int line )
 {
-	if( parts[0].compare( "base" ) == 0 )
+	if( parts[0] == "base" )
 	{
 		if( count < 2 || count > 3 )
 		{
@@ -289,17 +348,17 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[2] ) )
+		if( !parts[2].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
 			return 0;
 		}
 
-		m_settings_temp->m_base = data_file.substr( 0, data_file.rfind( "/" ) + 1 ) + parts[1];
+		m_settings_temp->m_base = data_file.substr( 0, data_file.rfind( "/" ) + 1 ) + parts[1].c_str();
 
 		// with settings option
-		if( count == 3 && string_to_int( parts[2] ) )
+		if( count == 3 && parts[2].To_Int() )
 		{
 			m_settings_temp->m_base_settings = 1;
 
@@ -307,7 +366,6 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			{
 				std::string settings_file = m_settings_temp->m_base;
 
-				// if settings file exists
 				while( !settings_file.empty() )
 				{
 					// if not already image settings based
@@ -317,20 +375,11 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 						settings_file.insert( settings_file.rfind( "." ) + 1, "settings" );
 					}
 
-					// not found
-					if( !File_Exists( settings_file ) )
-					{
-						break;
-					}
-
-					// create new temporary parser
-					cImage_Settings_Parser *temp_parser = new cImage_Settings_Parser();
-					cImage_Settings_Data *base_settings = temp_parser->Get( settings_file );
-					// finished loading base settings
-					delete temp_parser;
+					// base settings are only parsed once
+					const cImage_Settings_Data *base_settings = m_cache_parser->Get_Cached( settings_file );
 					settings_file.clear();
 
-					// handle
+					// handle if settings file exists
 					if( base_settings )
 					{
 						// todo : apply settings in reverse order ( deepest settings should override first )
@@ -341,14 +390,12 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 						{
 							settings_file = base_settings->m_base;
 						}
-						
-						delete base_settings;
 					}
 				}
 			}
 		}
 	}
-	else if( parts[0].compare( "int_x" ) == 0 )
+	else if( parts[0] == "int_x" )
 	{
 		if( count != 2 )
 		{
@@ -357,16 +404,16 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[1] ) )
+		if( !parts[1].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
 			return 0;
 		}
 
-		m_settings_temp->m_int_x = string_to_int( parts[1] );
+		m_settings_temp->m_int_x = parts[1].To_Int();
 	}
-	else if( parts[0].compare( "int_y" ) == 0 )
+	else if( parts[0] == "int_y" )
 	{
 		if( count != 2 )
 		{
@@ -375,16 +422,16 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[1] ) )
+		if( !parts[1].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
 			return 0;
 		}
 
-		m_settings_temp->m_int_y = string_to_int( parts[1] );
+		m_settings_temp->m_int_y = parts[1].To_Int();
 	}
-	else if( parts[0].compare( "col_rect" ) == 0 )
+	else if( parts[0] == "col_rect" )
 	{
 		if( count != 5 )
 		{
@@ -395,7 +442,7 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 
 		for( unsigned int i = 1; i < 5; i++ )
 		{
-			if( !Is_Valid_Number( parts[i] ) )
+			if( !parts[i].Is_Number() )
 			{
 				printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 				printf( "%s is not a valid integer value\n", parts[1].c_str() );
@@ -404,9 +451,9 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 		}
 
 		// position and dimension
-		m_settings_temp->m_col_rect = GL_rect( static_cast<float>(string_to_int( parts[1] )), static_cast<float>(string_to_int( parts[2] )), static_cast<float>(string_to_int( parts[3] )), static_cast<float>(string_to_int( parts[4] )) );
+		m_settings_temp->m_col_rect = GL_rect( static_cast<float>(parts[1].To_Int()), static_cast<float>(parts[2].To_Int()), static_cast<float>(parts[3].To_Int()), static_cast<float>(parts[4].To_Int()) );
 	}
-	else if( parts[0].compare( "width" ) == 0 )
+	else if( parts[0] == "width" )
 	{
 		if( count != 2 )
 		{
@@ -415,16 +462,16 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[1] ) )
+		if( !parts[1].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
 			return 0;
 		}
 
-		m_settings_temp->m_width = string_to_int( parts[1] );
+		m_settings_temp->m_width = parts[1].To_Int();
 	}
-	else if( parts[0].compare( "height" ) == 0 )
+	else if( parts[0] == "height" )
 	{
 		if( count != 2 )
 		{
@@ -433,16 +480,16 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[1] ) )
+		if( !parts[1].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
 			return 0;
 		}
 
-		m_settings_temp->m_height = string_to_int( parts[1] );
+		m_settings_temp->m_height = parts[1].To_Int();
 	}
-	else if( parts[0].compare( "rotation" ) == 0 )
+	else if( parts[0] == "rotation" )
 	{
 		if( count < 2 || count > 5 )
 		{
@@ -451,7 +498,7 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[1] ) )
+		if( !parts[1].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
@@ -459,34 +506,34 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 		}
 
 		// x
-		m_settings_temp->m_rotation_x = string_to_int( parts[1] );
+		m_settings_temp->m_rotation_x = parts[1].To_Int();
 
 		// y
 		if( count > 2 )
 		{
-			if( !Is_Valid_Number( parts[2] ) )
+			if( !parts[2].Is_Number() )
 			{
 				printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 				printf( "%s is not a valid integer value\n", parts[2].c_str() );
 				return 0; // error
 			}
 
-			m_settings_temp->m_rotation_y = string_to_int( parts[2] );
+			m_settings_temp->m_rotation_y = parts[2].To_Int();
 		}
 		// z
 		if( count > 3 )
 		{
-			if( !Is_Valid_Number( parts[3] ) )
+			if( !parts[3].Is_Number() )
 			{
 				printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 				printf( "%s is not a valid integer value\n", parts[3].c_str() );
 				return 0;
 			}
 
-			m_settings_temp->m_rotation_z = string_to_int( parts[3] );
+			m_settings_temp->m_rotation_z = parts[3].To_Int();
 		}
 	}
-	else if( parts[0].compare( "mipmap" ) == 0 )
+	else if( parts[0] == "mipmap" )
 	{
 		if( count != 2 )
 		{
@@ -495,7 +542,7 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[1] ) )
+		if( !parts[1].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
@@ -503,12 +550,12 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 		}
 
 		// if mipmaps enabled
-		if( string_to_int( parts[1] ) )
+		if( parts[1].To_Int() )
 		{
 			m_settings_temp->m_mipmap = 1;
 		}
 	}
-	else if( parts[0].compare( "editor_tags" ) == 0 )
+	else if( parts[0] == "editor_tags" )
 	{
 		if( count != 2 )
 		{
@@ -517,9 +564,9 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		m_settings_temp->m_editor_tags = parts[1];
+		m_settings_temp->m_editor_tags = parts[1].str();
 	}
-	else if( parts[0].compare( "name" ) == 0 )
+	else if( parts[0] == "name" )
 	{
 		if( count != 2 )
 		{
@@ -528,9 +575,9 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		m_settings_temp->m_name = parts[1];
+		m_settings_temp->m_name = parts[1].str();
 	}
-	else if( parts[0].compare( "type" ) == 0 )
+	else if( parts[0] == "type" )
 	{
 		if( count != 2 )
 		{
@@ -539,9 +586,9 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		m_settings_temp->m_type = Get_Sprite_Type_Id( parts[1] );
+		m_settings_temp->m_type = Get_Sprite_Type_Id( parts[1].str() );
 	}
-	else if( parts[0].compare( "ground_type" ) == 0 )
+	else if( parts[0] == "ground_type" )
 	{
 		if( count != 2 )
 		{
@@ -550,9 +597,9 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		m_settings_temp->m_ground_type = Get_Ground_Type_Id( parts[1] );
+		m_settings_temp->m_ground_type = Get_Ground_Type_Id( parts[1].str() );
 	}
-	else if( parts[0].compare( "author" ) == 0 )
+	else if( parts[0] == "author" )
 	{
 		if( count != 2 )
 		{
@@ -561,9 +608,9 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		m_settings_temp->m_author = parts[1];
+		m_settings_temp->m_author = parts[1].str();
 	}
-	else if( parts[0].compare( "obsolete" ) == 0 )
+	else if( parts[0] == "obsolete" )
 	{
 		if( count != 2 )
 		{
@@ -572,7 +619,7 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 			return 0;
 		}
 
-		if( !Is_Valid_Number( parts[1] ) )
+		if( !parts[1].Is_Number() )
 		{
 			printf( "%s : line %d Error : ", Trim_Filename( data_file, 0, 0 ).c_str(), line );
 			printf( "%s is not a valid integer value\n", parts[1].c_str() );
@@ -580,7 +627,7 @@ bool cImage_Settings_Parser :: HandleMessage( const std::string *parts, unsigned
 		}
 
 		// if tagged obsolete
-		if( string_to_int( parts[1] ) )
+		if( parts[1].To_Int() )
 		{
 			m_settings_temp->m_obsolete = 1;
 		}
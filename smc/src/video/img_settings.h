@@ -20,6 +20,7 @@
 #include "../core/file_parser.h"
 #include "../video/gl_surface.h"
 #include "../core/math/rect.h"
+#include <boost/unordered_map.hpp>
 
 namespace SMC
 {
@@ -80,19 +81,39 @@ public:
 	cImage_Settings_Parser( void );
 	virtual ~cImage_Settings_Parser( void );
 
-	/* Returns the settings from the given file
+	/* Returns the settings from the given file or NULL if it does not exist
 	 * load_base_settings : if set will overwrite settings with all base settings if available
 	 * The returned settings data should be deleted if not used anymore
 	*/
 	cImage_Settings_Data *Get( const std::string &filename, bool load_base_settings = 1 );
+	/* Returns the cached settings from the given file or NULL if it does not exist
+	 * every file is only parsed once until the cache is cleared when the images are reloaded from file
+	 * the returned settings are owned by the cache
+	 * load_base_settings : if set will overwrite settings with all base settings if available
+	*/
+	const cImage_Settings_Data *Get_Cached( const std::string &filename, bool load_base_settings = 1 );
+	// Delete all cached settings
+	void Clear_Cache( void );
 
 	// Handle one tokenized line
-	virtual bool HandleMessage( const std::string *parts, unsigned int count, unsigned int line );
+	virtual bool HandleMessage( const cFile_Token *parts, unsigned int count, unsigned int line );
 
 	// temp settings used for loading
 	cImage_Settings_Data *m_settings_temp;
 	// load base settings
 	bool m_load_base;
+
+private:
+	// Parse the file and return the new settings
+	cImage_Settings_Data *Parse_Settings( const std::string &filename, bool load_base_settings );
+
+	typedef boost::unordered_map<std::string, cImage_Settings_Data *> SettingsCache;
+	/* parsed settings by filename without and with base settings
+	 * files which do not exist are cached as NULL
+	*/
+	SettingsCache m_cache[2];
+	// parser with the cache used for base settings
+	cImage_Settings_Parser *m_cache_parser;
 };
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
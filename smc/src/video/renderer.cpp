@@ -16,6 +16,7 @@
 #include "../video/renderer.h"
 #include "../core/game_core.h"
 #include <algorithm>
+#include <cstring>
 // SDL
 #include "SDL.h"
 #include "SDL_opengl.h"
@@ -28,8 +29,34 @@ namespace SMC
 #endif
 
 const float doubled_pi = static_cast<float>(M_PI * 2.0f);
+const float degree_to_radian = static_cast<float>(M_PI / 180.0f);
+
+// timer query definitions from GL_EXT_timer_query and OpenGL 1.5
+#ifndef GL_TIME_ELAPSED_EXT
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+typedef void (APIENTRY *Gl_Gen_Queries_Func)( GLsizei n, GLuint *ids );
+typedef void (APIENTRY *Gl_Begin_Query_Func)( GLenum target, GLuint id );
+typedef void (APIENTRY *Gl_End_Query_Func)( GLenum target );
+typedef void (APIENTRY *Gl_Get_Query_Object_iv_Func)( GLuint id, GLenum pname, GLint *params );
+typedef void (APIENTRY *Gl_Get_Query_Object_ui64v_Func)( GLuint id, GLenum pname, Uint64 *params );
 static GLuint last_bind_texture = 0;
 
+// statistics of the current frame
+static cRender_Statistics render_statistics_current;
+// statistics of the last finished frame
+static cRender_Statistics render_statistics_last;
+
 /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
 
 cRender_Request :: cRender_Request( void )
@@ -115,6 +142,7 @@ void cRender_Request_Advanced :: Render_Basic( void )
 	if( m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA )
 	{
 		glBlendFunc( m_blend_sfactor, m_blend_dfactor );
+		render_statistics_current.m_blend_changes++;
 	}
 }
 
@@ -124,6 +152,7 @@ void cRender_Request_Advanced :: Render_Basic_Clear( void ) const
 	if( m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA )
 	{
 		glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+		render_statistics_current.m_blend_changes++;
 	}
 
 	// if debug build check for errors
@@ -162,6 +191,7 @@ void cRender_Request_Advanced :: Render_Advanced( void )
 		glTexEnvi( GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_CONSTANT );
 		glTexEnvfv( GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, m_combine_color );
 		glTexEnvi( GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_TEXTURE );
+		render_statistics_current.m_combine_changes++;
 	}
 }
 
@@ -174,6 +204,7 @@ void cRender_Request_Advanced :: Render_Advanced_Clear( void ) const
 		glTexEnvfv( GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, col );
 		glTexEnvi( GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE );
 		glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+		render_statistics_current.m_combine_changes++;
 	}
 }
 
@@ -239,6 +270,8 @@ void cLine_Request :: Draw( void )
 		glVertex2f( m_line.m_x2, m_line.m_y2 );
 	glEnd();
 
+	render_statistics_current.m_vertices += 2;
+
 	// clear stipple pattern
 	if( m_stipple_pattern != 0 )
 	{
@@ -352,6 +385,8 @@ void cRect_Request :: Draw( void )
 		glVertex2f( -half_w, half_h );
 	glEnd();
 
+	render_statistics_current.m_vertices += 4;
+
 	// clear stipple pattern
 	if( m_stipple_pattern != 0 )
 	{
@@ -423,6 +458,8 @@ void cGradient_Request :: Draw( void )
 			glVertex2f( 0.0f, m_rect.m_h );
 		glEnd();
 
+		render_statistics_current.m_vertices += 4;
+
 	}
 	else if( m_dir == DIR_HORIZONTAL )
 	{
@@ -434,6 +471,8 @@ void cGradient_Request :: Draw( void )
 			glVertex2f( m_rect.m_w, 0.0f );
 			glVertex2f( m_rect.m_w, m_rect.m_h );
 		glEnd();
+
+		render_statistics_current.m_vertices += 4;
 	}
 
 	// clear color
@@ -504,6 +543,7 @@ void cCircle_Request :: Draw( void )
 
 		// start with center
 		glVertex2f( 0.0f, 0.0f );
+		render_statistics_current.m_vertices++;
 	}
 
 	// set step size based on radius
@@ -521,6 +561,7 @@ void cCircle_Request :: Draw( void )
 	{
 		glVertex2f( m_radius * sin( angle ), m_radius * cos( angle ) );
 		angle += step_size;
+		render_statistics_current.m_vertices++;
 	}
 
 	// draw to end
@@ -529,6 +570,8 @@ void cCircle_Request :: Draw( void )
 
 	glEnd();
 
+	render_statistics_current.m_vertices++;
+
 	// clear line width
 	if( m_line_width != 1 )
 	{
@@ -663,6 +706,7 @@ void cSurface_Request :: Draw( void )
 	{
 		glBindTexture( GL_TEXTURE_2D, m_texture_id );
 		last_bind_texture = m_texture_id;
+		render_statistics_current.m_texture_binds++;
 	}
 
 	/* vertex arrays should not be used to draw simple primitives as it
@@ -684,6 +728,8 @@ void cSurface_Request :: Draw( void )
 		glVertex2f( -half_w, half_h );
 	glEnd();
 
+	render_statistics_current.m_vertices += 4;
+
 	// clear color
 	if( m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255 )
 	{
@@ -697,6 +743,153 @@ void cSurface_Request :: Draw( void )
 	Render_Basic_Clear();
 }
 
+/* *** *** *** *** *** *** cSurface_Batch_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+cSurface_Batch_Item :: cSurface_Batch_Item( void )
+{
+	m_pos_x = 0.0f;
+	m_pos_y = 0.0f;
+	m_pos_z = 0.0f;
+
+	m_scale_x = 1.0f;
+	m_scale_y = 1.0f;
+
+	m_rot_x = 0.0f;
+	m_rot_y = 0.0f;
+	m_rot_z = 0.0f;
+
+	m_color = static_cast<Uint8>(255);
+}
+
+cSurface_Batch_Request :: cSurface_Batch_Request( void )
+: cRender_Request_Advanced()
+{
+	m_type = REND_SURFACE_BATCH;
+	m_texture_id = 0;
+
+	m_w = 0.0f;
+	m_h = 0.0f;
+}
+
+cSurface_Batch_Request :: ~cSurface_Batch_Request( void )
+{
+
+}
+
+void cSurface_Batch_Request :: Draw( void )
+{
+	Draw_Items( 0, m_items.size() );
+}
+
+void cSurface_Batch_Request :: Draw_Items( unsigned int start, unsigned int end )
+{
+	if( start >= end )
+	{
+		return;
+	}
+
+	Render_Basic();
+
+	// get half the size
+	const float half_w = m_w / 2;
+	const float half_h = m_h / 2;
+
+	// camera position
+	float camera_x = 0.0f;
+	float camera_y = 0.0f;
+
+	if( !m_no_camera )
+	{
+		camera_x = pActive_Camera->m_x;
+		camera_y = pActive_Camera->m_y;
+	}
+
+	if( !glIsEnabled( GL_TEXTURE_2D ) )
+	{
+		glEnable( GL_TEXTURE_2D );
+	}
+
+	// only bind if not the same texture
+	if( last_bind_texture != m_texture_id )
+	{
+		glBindTexture( GL_TEXTURE_2D, m_texture_id );
+		last_bind_texture = m_texture_id;
+		render_statistics_current.m_texture_binds++;
+	}
+
+	// corners in the order top left, top right, bottom right and bottom left
+	const float corner_x[4] = { -half_w, half_w, half_w, -half_w };
+	const float corner_y[4] = { -half_h, -half_h, half_h, half_h };
+	const float tex_x[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+	const float tex_y[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+	glBegin( GL_QUADS );
+
+	for( SurfaceBatchItemList::const_iterator itr = m_items.begin() + start; itr != m_items.begin() + end; ++itr )
+	{
+		const cSurface_Batch_Item &item = (*itr);
+
+		// position
+		const float final_pos_x = item.m_pos_x + ( half_w * item.m_scale_x ) - camera_x;
+		const float final_pos_y = item.m_pos_y + ( half_h * item.m_scale_y ) - camera_y;
+
+		glColor4ub( item.m_color.red, item.m_color.green, item.m_color.blue, item.m_color.alpha );
+
+		// no rotation
+		if( item.m_rot_x == 0.0f && item.m_rot_y == 0.0f && item.m_rot_z == 0.0f )
+		{
+			for( unsigned int i = 0; i < 4; i++ )
+			{
+				glTexCoord2f( tex_x[i], tex_y[i] );
+				glVertex3f( final_pos_x + ( corner_x[i] * item.m_scale_x ), final_pos_y + ( corner_y[i] * item.m_scale_y ), item.m_pos_z );
+			}
+
+			continue;
+		}
+
+		// same transformation as translate, scale and rotate x, y and z in cSurface_Request
+		const float sin_x = sin( item.m_rot_x * degree_to_radian );
+		const float cos_x = cos( item.m_rot_x * degree_to_radian );
+		const float sin_y = sin( item.m_rot_y * degree_to_radian );
+		const float cos_y = cos( item.m_rot_y * degree_to_radian );
+		const float sin_z = sin( item.m_rot_z * degree_to_radian );
+		const float cos_z = cos( item.m_rot_z * degree_to_radian );
+
+		for( unsigned int i = 0; i < 4; i++ )
+		{
+			// rotate z
+			const float x1 = ( corner_x[i] * cos_z ) - ( corner_y[i] * sin_z );
+			const float y1 = ( corner_x[i] * sin_z ) + ( corner_y[i] * cos_z );
+			// rotate y
+			const float x2 = x1 * cos_y;
+			const float z2 = -x1 * sin_y;
+			// rotate x
+			const float y3 = ( y1 * cos_x ) - ( z2 * sin_x );
+			const float z3 = ( y1 * sin_x ) + ( z2 * cos_x );
+
+			glTexCoord2f( tex_x[i], tex_y[i] );
+			glVertex3f( final_pos_x + ( x2 * item.m_scale_x ), final_pos_y + ( y3 * item.m_scale_y ), item.m_pos_z + z3 );
+		}
+	}
+
+	glEnd();
+
+	render_statistics_current.m_vertices += ( end - start ) * 4;
+
+	// clear color
+	glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+
+	Render_Basic_Clear();
+}
+
+unsigned int cSurface_Batch_Request :: Get_Item_Index( float pos_z, unsigned int start /* = 0 */ ) const
+{
+	cSurface_Batch_Item item;
+	item.m_pos_z = pos_z;
+
+	return std::lower_bound( m_items.begin() + start, m_items.end(), item, zpos_sort() ) - m_items.begin();
+}
+
 /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
 
 cRenderQueue :: cRenderQueue( unsigned int reserve_items )
@@ -732,13 +925,34 @@ void cRenderQueue :: Render( bool clear /* = 1 */ )
 	std::sort( m_render_data.begin(), m_render_data.end(), zpos_sort() );
 	// reset last texture
 	last_bind_texture = 0;
+	// batches with items above the z position of the following requests
+	BatchDrawList batches;
 
 	for( RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr )
 	{
 		cRender_Request *obj = (*itr);
 
-		obj->Draw();
+		Draw_Batch_Items( batches, obj->m_pos_z );
+
+		// drawn up to the z position of the following requests
+		if( obj->m_type == REND_SURFACE_BATCH )
+		{
+			batches.push_back( BatchDrawList::value_type( static_cast<cSurface_Batch_Request *>(obj), 0 ) );
+		}
+		else
+		{
+			obj->Draw();
+		}
+
 		obj->m_render_count--;
+
+		render_statistics_current.m_requests[obj->m_type]++;
+	}
+
+	// draw the remaining batch items
+	for( BatchDrawList::iterator itr = batches.begin(); itr != batches.end(); ++itr )
+	{
+		itr->first->Draw_Items( itr->second, itr->first->m_items.size() );
 	}
 
 	if( clear )
@@ -747,6 +961,28 @@ void cRenderQueue :: Render( bool clear /* = 1 */ )
 	}
 }
 
+void cRenderQueue :: Draw_Batch_Items( BatchDrawList &batches, float pos_z )
+{
+	for( BatchDrawList::iterator itr = batches.begin(); itr != batches.end(); )
+	{
+		cSurface_Batch_Request *batch = itr->first;
+		const unsigned int end = batch->Get_Item_Index( pos_z, itr->second );
+
+		batch->Draw_Items( itr->second, end );
+		itr->second = end;
+
+		// finished
+		if( end >= batch->m_items.size() )
+		{
+			itr = batches.erase( itr );
+		}
+		else
+		{
+			++itr;
+		}
+	}
+}
+
 void cRenderQueue :: Fake_Render( unsigned int amount /* = 1 */, bool clear /* = 1 */ )
 {
 	for( RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr )
@@ -781,6 +1017,170 @@ void cRenderQueue :: Clear( bool force /* = 1 */ )
 	}
 }
 
+/* *** *** *** *** *** *** cRender_Statistics *** *** *** *** *** *** *** *** *** *** *** */
+
+cRender_Statistics :: cRender_Statistics( void )
+{
+	Reset();
+	m_gpu_ms = -1.0f;
+}
+
+void cRender_Statistics :: Reset( void )
+{
+	for( unsigned int i = 0; i < REND_TYPE_AMOUNT; i++ )
+	{
+		m_requests[i] = 0;
+	}
+
+	m_texture_binds = 0;
+	m_blend_changes = 0;
+	m_combine_changes = 0;
+	m_vertices = 0;
+}
+
+unsigned int cRender_Statistics :: Get_Request_Count( void ) const
+{
+	unsigned int count = 0;
+
+	for( unsigned int i = 0; i < REND_TYPE_AMOUNT; i++ )
+	{
+		count += m_requests[i];
+	}
+
+	return count;
+}
+
+/* *** *** *** *** *** *** Render timer *** *** *** *** *** *** *** *** *** *** *** */
+
+// timer query functions
+static Gl_Gen_Queries_Func gl_gen_queries = NULL;
+static Gl_Begin_Query_Func gl_begin_query = NULL;
+static Gl_End_Query_Func gl_end_query = NULL;
+static Gl_Get_Query_Object_iv_Func gl_get_query_object_iv = NULL;
+static Gl_Get_Query_Object_ui64v_Func gl_get_query_object_ui64v = NULL;
+
+/* queries used alternately
+ * the result of the last frame is read while the current frame is measured
+*/
+static GLuint render_timer_queries[2] = { 0, 0 };
+// if the query has a pending result
+static bool render_timer_query_pending[2] = { 0, 0 };
+// query of the current frame
+static unsigned int render_timer_query_current = 0;
+// if a query is running
+static bool render_timer_running = 0;
+
+// Return the address of the OpenGL function or of the alternative name
+static void *Get_GL_Function( const char *name, const char *name_alt )
+{
+	void *func = SDL_GL_GetProcAddress( name );
+
+	if( !func )
+	{
+		func = SDL_GL_GetProcAddress( name_alt );
+	}
+
+	return func;
+}
+
+void Init_Render_Timer( void )
+{
+	// queries from an old context are invalid
+	gl_gen_queries = NULL;
+	gl_begin_query = NULL;
+	gl_end_query = NULL;
+	gl_get_query_object_iv = NULL;
+	gl_get_query_object_ui64v = NULL;
+	render_timer_query_pending[0] = 0;
+	render_timer_query_pending[1] = 0;
+	render_timer_query_current = 0;
+	render_timer_running = 0;
+	render_statistics_last.m_gpu_ms = -1.0f;
+
+	const char *extensions = reinterpret_cast<const char *>(glGetString( GL_EXTENSIONS ));
+
+	if( !extensions || ( !strstr( extensions, "GL_EXT_timer_query" ) && !strstr( extensions, "GL_ARB_timer_query" ) ) )
+	{
+		if( game_debug )
+		{
+			printf( "Info : OpenGL timer queries not supported. GPU time is not available\n" );
+		}
+
+		return;
+	}
+
+	gl_gen_queries = reinterpret_cast<Gl_Gen_Queries_Func>(Get_GL_Function( "glGenQueries", "glGenQueriesARB" ));
+	gl_begin_query = reinterpret_cast<Gl_Begin_Query_Func>(Get_GL_Function( "glBeginQuery", "glBeginQueryARB" ));
+	gl_end_query = reinterpret_cast<Gl_End_Query_Func>(Get_GL_Function( "glEndQuery", "glEndQueryARB" ));
+	gl_get_query_object_iv = reinterpret_cast<Gl_Get_Query_Object_iv_Func>(Get_GL_Function( "glGetQueryObjectiv", "glGetQueryObjectivARB" ));
+	gl_get_query_object_ui64v = reinterpret_cast<Gl_Get_Query_Object_ui64v_Func>(Get_GL_Function( "glGetQueryObjectui64v", "glGetQueryObjectui64vEXT" ));
+
+	if( !Is_Render_Timer_Available() )
+	{
+		printf( "Warning : OpenGL timer query functions not found\n" );
+		gl_gen_queries = NULL;
+		return;
+	}
+
+	gl_gen_queries( 2, render_timer_queries );
+}
+
+bool Is_Render_Timer_Available( void )
+{
+	return gl_gen_queries && gl_begin_query && gl_end_query && gl_get_query_object_iv && gl_get_query_object_ui64v;
+}
+
+void Begin_Render_Frame( void )
+{
+	if( render_timer_running || !Is_Render_Timer_Available() )
+	{
+		return;
+	}
+
+	gl_begin_query( GL_TIME_ELAPSED_EXT, render_timer_queries[render_timer_query_current] );
+	render_timer_running = 1;
+}
+
+void End_Render_Frame( void )
+{
+	float gpu_ms = render_statistics_last.m_gpu_ms;
+
+	if( render_timer_running )
+	{
+		gl_end_query( GL_TIME_ELAPSED_EXT );
+		render_timer_running = 0;
+		render_timer_query_pending[render_timer_query_current] = 1;
+
+		// switch to the query of the last frame
+		render_timer_query_current = !render_timer_query_current;
+
+		if( render_timer_query_pending[render_timer_query_current] )
+		{
+			GLint available = 0;
+			gl_get_query_object_iv( render_timer_queries[render_timer_query_current], GL_QUERY_RESULT_AVAILABLE, &available );
+
+			// if not available it gets discarded by the next query
+			if( available )
+			{
+				Uint64 elapsed_ns = 0;
+				gl_get_query_object_ui64v( render_timer_queries[render_timer_query_current], GL_QUERY_RESULT, &elapsed_ns );
+				gpu_ms = static_cast<float>(elapsed_ns) * 0.000001f;
+			}
+
+			render_timer_query_pending[render_timer_query_current] = 0;
+		}
+	}
+
+	render_statistics_last = render_statistics_current;
+	render_statistics_last.m_gpu_ms = gpu_ms;
+	render_statistics_current.Reset();
+}
+
+const cRender_Statistics &Get_Render_Statistics( void )
+{
+	return render_statistics_last;
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 cRenderQueue *pRenderer = NULL;
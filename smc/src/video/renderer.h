@@ -34,7 +34,9 @@ enum RenderType
 	REND_SURFACE = 4,
 	REND_TEXT = 5, // todo
 	REND_LINE = 6,
-	REND_CIRCLE = 7
+	REND_CIRCLE = 7,
+	REND_SURFACE_BATCH = 8,
+	REND_TYPE_AMOUNT = 9
 };
 
 /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
@@ -229,6 +231,68 @@ public:
 	bool m_delete_texture;
 };
 
+/* *** *** *** *** *** *** cSurface_Batch_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+// Surface batch item
+class cSurface_Batch_Item
+{
+public:
+	cSurface_Batch_Item( void );
+
+	// position
+	float m_pos_x;
+	float m_pos_y;
+	float m_pos_z;
+	// scale
+	float m_scale_x;
+	float m_scale_y;
+	// rotation
+	float m_rot_x;
+	float m_rot_y;
+	float m_rot_z;
+	// color
+	Color m_color;
+};
+
+typedef vector<cSurface_Batch_Item> SurfaceBatchItemList;
+
+/* Draws many copies of the same texture with one state setup
+ * every item is transformed like a cSurface_Request
+ * the items must be sorted by z position and the request z position is the lowest item z position
+ * the render queue draws the items between the other requests with the matching z position
+*/
+class cSurface_Batch_Request : public cRender_Request_Advanced
+{
+public:
+	cSurface_Batch_Request( void );
+	virtual ~cSurface_Batch_Request( void );
+
+	// Draw
+	virtual void Draw( void );
+	// Draw the items from start to end which is not included
+	void Draw_Items( unsigned int start, unsigned int end );
+	// Return the index of the first item with a z position not below the given z position
+	unsigned int Get_Item_Index( float pos_z, unsigned int start = 0 ) const;
+
+	// texture id
+	GLuint m_texture_id;
+	// size
+	float m_w;
+	float m_h;
+
+	// items
+	SurfaceBatchItemList m_items;
+
+	// Z position sort
+	struct zpos_sort
+	{
+		bool operator()( const cSurface_Batch_Item &a, const cSurface_Batch_Item &b ) const
+		{
+			return a.m_pos_z < b.m_pos_z;
+		}
+	};
+};
+
 /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
 
 class cRenderQueue
@@ -260,6 +324,13 @@ public:
 	// render data array
 	RenderList m_render_data;
 
+	// batch requests and their first item not drawn yet
+	typedef vector<std::pair<cSurface_Batch_Request *, unsigned int> > BatchDrawList;
+	/* Draw the batch items below the given z position
+	 * finished batches are removed
+	*/
+	static void Draw_Batch_Items( BatchDrawList &batches, float pos_z );
+
 	// Z position sort
 	struct zpos_sort
 	{
@@ -270,6 +341,53 @@ public:
 	};
 };
 
+/* *** *** *** *** *** *** cRender_Statistics *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Render counters of a frame
+ * collected while drawing the render requests
+*/
+class cRender_Statistics
+{
+public:
+	cRender_Statistics( void );
+
+	// Reset all counters
+	void Reset( void );
+	// Return the amount of drawn requests of all types
+	unsigned int Get_Request_Count( void ) const;
+
+	// drawn requests per render type
+	unsigned int m_requests[REND_TYPE_AMOUNT];
+	// glBindTexture calls
+	unsigned int m_texture_binds;
+	// blend function changes
+	unsigned int m_blend_changes;
+	// texture combine changes
+	unsigned int m_combine_changes;
+	// vertices sent
+	unsigned int m_vertices;
+	// GPU time in milliseconds or a negative value if not available
+	float m_gpu_ms;
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Initialize the GPU frame timer
+ * uses timer queries if the OpenGL extension is available
+ * must be called again after the OpenGL context was recreated
+*/
+void Init_Render_Timer( void );
+// Return true if the GPU frame time can be measured
+bool Is_Render_Timer_Available( void );
+// Start measuring the GPU time of the current frame
+void Begin_Render_Frame( void );
+/* Finish the current frame statistics
+ * the GPU time is read from the previous frame query to not stall the pipeline
+*/
+void End_Render_Frame( void );
+// Return the statistics of the last finished frame
+const cRender_Statistics &Get_Render_Statistics( void );
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 // Renderer class
@@ -52,6 +52,43 @@
 namespace SMC
 {
 
+/* *** *** *** *** *** *** *** cResource_Provider *** *** *** *** *** *** *** *** *** *** */
+
+/* CEGUI resource provider reading files through the resource manager
+ * used by the GUI and every XML file parsed by CEGUI to also load packaged files
+*/
+class cResource_Provider : public CEGUI::DefaultResourceProvider
+{
+public:
+	void loadRawDataContainer( const CEGUI::String &filename, CEGUI::RawDataContainer &output, const CEGUI::String &resourceGroup )
+	{
+		const CEGUI::String final_filename = getFinalFilename( filename, resourceGroup );
+		SDL_RWops *rw = pResource_Manager->Open_File( final_filename.c_str() );
+
+		if( !rw )
+		{
+			throw CEGUI::InvalidRequestException( "cResource_Provider::loadRawDataContainer - Unable to open resource file '" + final_filename + "'" );
+		}
+
+		const int size = SDL_RWseek( rw, 0, RW_SEEK_END );
+		SDL_RWseek( rw, 0, RW_SEEK_SET );
+
+		CEGUI::uint8 *buffer = new CEGUI::uint8[size > 0 ? size : 1];
+
+		if( size < 0 || SDL_RWread( rw, buffer, 1, size ) != size )
+		{
+			delete[] buffer;
+			SDL_RWclose( rw );
+			throw CEGUI::InvalidRequestException( "cResource_Provider::loadRawDataContainer - Problem reading resource file '" + final_filename + "'" );
+		}
+
+		SDL_RWclose( rw );
+
+		output.setData( buffer );
+		output.setSize( size );
+	}
+};
+
 /* *** *** *** *** *** *** *** Video class *** *** *** *** *** *** *** *** *** *** */
 
 cVideo :: cVideo( void )
@@ -77,19 +114,23 @@ cVideo :: cVideo( void )
 	glx_context = NULL;
 #endif
 	m_render_thread = boost::thread();
+	m_decode_thread = boost::thread();
+
+	m_performance_log_frame = 0;
+	m_performance_log_failed = 0;
 
 	m_initialised = 0;
 }
 
 cVideo :: ~cVideo( void )
 {
-
+	Clear_Decoded_Images();
 }
 
 void cVideo :: Init_CEGUI_Fake( void ) const
 {
 	// create fake Resource Provider
-	CEGUI::DefaultResourceProvider *rp = new CEGUI::DefaultResourceProvider();
+	CEGUI::DefaultResourceProvider *rp = new cResource_Provider();
 	// set Resource Provider directories
 	if( CEGUI::System::getDefaultXMLParserName().compare( "XercesParser" ) == 0 )
 	{
@@ -135,7 +176,7 @@ void cVideo :: Init_CEGUI( void ) const
 	pGuiRenderer->enableExtraStateSettings( 1 );
 
 	// create Resource Provider
-	CEGUI::DefaultResourceProvider *rp = new CEGUI::DefaultResourceProvider();
+	CEGUI::DefaultResourceProvider *rp = new cResource_Provider();
 
 	// set Resource Provider directories
 	rp->setResourceGroupDirectory( "schemes", DATA_DIR "/" GUI_SCHEME_DIR "/" );
@@ -294,7 +335,7 @@ void cVideo :: Init_Video( bool reload_textures_from_file /* = 0 */, bool use_pr
 		std::string filename_icon = DATA_DIR "/" GAME_ICON_DIR "/window_32.png";
 		if( File_Exists( filename_icon ) )
 		{
-			SDL_Surface *icon = IMG_Load( filename_icon.c_str() );
+			SDL_Surface *icon = IMG_Load_RW( pResource_Manager->Open_File( filename_icon ), 1 );
 			SDL_WM_SetIcon( icon, NULL );
 			SDL_FreeSurface( icon );
 		}
@@ -506,6 +547,8 @@ void cVideo :: Init_Video( bool reload_textures_from_file /* = 0 */, bool use_pr
 
 	// initialize opengl
 	Init_OpenGL();
+	// initialize the gpu frame timer for the new context
+	Init_Render_Timer();
 
 	// if reinitialization
 	if( m_initialised )
@@ -1028,6 +1071,9 @@ void cVideo :: Render( bool threaded /* = 0 */ )
 		// update performance timer
 		pFramerate->m_perf_timer[PERF_RENDER_GUI]->Update();
 
+		// gpu time is not measured as the game is rendered in another thread
+		End_Render_Frame();
+
 		SDL_GL_SwapBuffers();
 
 		// update performance timer
@@ -1053,6 +1099,8 @@ void cVideo :: Render( bool threaded /* = 0 */ )
 	// single thread mode
 	else
 	{
+		Begin_Render_Frame();
+
 		pRenderer->Render();
 
 		// update performance timer
@@ -1063,11 +1111,15 @@ void cVideo :: Render( bool threaded /* = 0 */ )
 		// update performance timer
 		pFramerate->m_perf_timer[PERF_RENDER_GUI]->Update();
 
+		End_Render_Frame();
+
 		SDL_GL_SwapBuffers();
 
 		// update performance timer
 		pFramerate->m_perf_timer[PERF_RENDER_BUFFER]->Update();
 	}
+
+	Update_Performance_Log();
 }
 
 void cVideo :: Render_Finish( void )
@@ -1084,6 +1136,87 @@ void cVideo :: Render_Finish( void )
 	Make_GL_Context_Current();
 }
 
+void cVideo :: Update_Performance_Log( void )
+{
+	if( !game_debug_performance )
+	{
+		// finished logging
+		if( m_performance_log.is_open() )
+		{
+			m_performance_log.close();
+		}
+
+		return;
+	}
+
+	// open log
+	if( !m_performance_log.is_open() )
+	{
+		// already failed
+		if( m_performance_log_failed )
+		{
+			return;
+		}
+
+		const std::string filename = pResource_Manager->user_data_dir + "performance.csv";
+
+	#ifdef _WIN32
+		m_performance_log.open( utf8_to_ucs2( filename ).c_str(), ios::out | ios::trunc );
+	#else
+		m_performance_log.open( filename.c_str(), ios::out | ios::trunc );
+	#endif
+
+		if( !m_performance_log.is_open() )
+		{
+			printf( "Error : couldn't open performance log %s\n", filename.c_str() );
+			m_performance_log_failed = 1;
+			return;
+		}
+
+		// timer names in performance_timer_type order
+		static const char *timer_names[] = {
+			"update_process_input", "update_level", "update_level_editor", "update_hud", "update_player", "update_level_collisions",
+			"update_camera", "draw_level_layer1", "draw_level_player", "draw_level_layer2", "draw_level_hud", "draw_level_editor",
+			"draw_mouse", "render_game", "draw_menu", "draw_level_settings", "draw_overworld", "update_overworld",
+			"update_menu", "update_level_settings", "render_gui", "render_buffer", "update_late_level", "update_player_collisions" };
+
+		m_performance_log << "frame,ticks";
+
+		for( unsigned int i = 0; i < pFramerate->m_perf_timer.size(); i++ )
+		{
+			if( i < sizeof(timer_names) / sizeof(timer_names[0]) )
+			{
+				m_performance_log << "," << timer_names[i];
+			}
+			else
+			{
+				m_performance_log << ",timer_" << i;
+			}
+		}
+
+		m_performance_log << ",requests,rects,gradients,surfaces,lines,circles,surface_batches,texture_binds,blend_changes,combine_changes,vertices,gpu_ms" << std::endl;
+
+		m_performance_log_frame = 0;
+	}
+
+	const cRender_Statistics &statistics = Get_Render_Statistics();
+
+	m_performance_log << m_performance_log_frame << "," << SDL_GetTicks();
+
+	// milliseconds of every stage in this frame
+	for( cFramerate::Performance_Timer_List::const_iterator itr = pFramerate->m_perf_timer.begin(); itr != pFramerate->m_perf_timer.end(); ++itr )
+	{
+		m_performance_log << "," << (*itr)->last_ms;
+	}
+
+	m_performance_log << "," << statistics.Get_Request_Count() << "," << statistics.m_requests[REND_RECT] << "," << statistics.m_requests[REND_GRADIENT]
+		<< "," << statistics.m_requests[REND_SURFACE] << "," << statistics.m_requests[REND_LINE] << "," << statistics.m_requests[REND_CIRCLE]
+		<< "," << statistics.m_requests[REND_SURFACE_BATCH] << "," << statistics.m_texture_binds << "," << statistics.m_blend_changes
+		<< "," << statistics.m_combine_changes << "," << statistics.m_vertices << "," << statistics.m_gpu_ms << "\n";
+
+	m_performance_log_frame++;
+}
+
 void cVideo :: Toggle_Fullscreen( void )
 {
 	Render_Finish();
@@ -1165,47 +1298,26 @@ cVideo::cSoftware_Image cVideo :: Load_Image( std::string filename, bool load_se
 			settings_file.insert( settings_file.rfind( "." ) + 1, "settings" );
 		}
 
-		// if a settings file exists
-		if( File_Exists( settings_file ) )
-		{
-			settings = pSettingsParser->Get( settings_file );
-
-			// add cache dir and remove data dir
-			std::string img_filename_cache = m_imgcache_dir + "/" + settings_file.substr( strlen( DATA_DIR "/" ) ) + ".png";
-
-			// check if image cache file exists
-			if( File_Exists( img_filename_cache ) )
-			{
-				sdl_surface = IMG_Load( img_filename_cache.c_str() );
-			}
-			// image given in base settings
-			else if( !settings->m_base.empty() )
-			{
-				// use current directory
-				std::string img_filename = filename.substr( 0, filename.rfind( "/" ) + 1 ) + settings->m_base;
+		settings = pSettingsParser->Get( settings_file );
+	}
 
-				// not found
-				if( !File_Exists( img_filename ) )
-				{
-					// use data dir
-					img_filename = settings->m_base;
+	const std::string img_filename = Get_Image_Source( filename, settings, m_imgcache_dir );
 
-					// pixmaps dir must be given
-					if( img_filename.find( DATA_DIR "/" GAME_PIXMAPS_DIR "/" ) == std::string::npos )
-					{
-						img_filename.insert( 0, DATA_DIR "/" GAME_PIXMAPS_DIR "/" );
-					}
-				}
-
-				sdl_surface = IMG_Load( img_filename.c_str() );
-			}
-		}
+	if( !img_filename.empty() )
+	{
+		sdl_surface = Load_SDL_Surface( img_filename );
 	}
 
-	// if not set in image settings and file exists
-	if( !sdl_surface && File_Exists( filename ) && ( !settings || settings->m_base.empty() ) )
+	// the image cache file could be damaged
+	if( !sdl_surface && settings && !m_imgcache_dir.empty() )
 	{
-		sdl_surface = IMG_Load( filename.c_str() );
+		const std::string img_filename_original = Get_Image_Source( filename, settings, std::string() );
+
+		if( !img_filename_original.empty() && img_filename_original != img_filename )
+		{
+			printf( "Warning : Couldn't load image cache file %s. Using the original image\n", img_filename.c_str() );
+			sdl_surface = Load_SDL_Surface( img_filename_original );
+		}
 	}
 
 	if( !sdl_surface )
@@ -1229,6 +1341,187 @@ cVideo::cSoftware_Image cVideo :: Load_Image( std::string filename, bool load_se
 	return software_image;
 }
 
+void cVideo :: Start_Image_Decode( const vector<std::string> &filenames )
+{
+	Wait_Image_Decode();
+
+	// the image cache directory is set later in Init_Image_Cache
+	std::string imgcache_dir;
+
+	if( pPreferences->m_image_cache_enabled && pPreferences->m_game_version == smc_version )
+	{
+		imgcache_dir = pResource_Manager->user_data_dir + USER_IMGCACHE_DIR "/" + int_to_string( pPreferences->m_video_screen_w ) + "x" + int_to_string( pPreferences->m_video_screen_h );
+
+		if( !Dir_Exists( imgcache_dir ) )
+		{
+			imgcache_dir.clear();
+		}
+	}
+
+	// resolve the image files here as the settings parser is not thread safe
+	vector<std::string> image_files;
+
+	for( vector<std::string>::const_iterator itr = filenames.begin(); itr != filenames.end(); ++itr )
+	{
+		std::string filename = (*itr);
+
+		// pixmaps dir must be given
+		if( filename.find( DATA_DIR "/" GAME_PIXMAPS_DIR "/" ) == std::string::npos )
+		{
+			filename.insert( 0, DATA_DIR "/" GAME_PIXMAPS_DIR "/" );
+		}
+
+		std::string settings_file = filename;
+
+		if( settings_file.rfind( ".settings" ) == std::string::npos )
+		{
+			settings_file.erase( settings_file.rfind( "." ) + 1 );
+			settings_file.insert( settings_file.rfind( "." ) + 1, "settings" );
+		}
+		// .settings file type can't be used directly
+		else
+		{
+			filename.erase( filename.rfind( ".settings" ) );
+			filename.insert( filename.length(), ".png" );
+		}
+
+		const std::string img_filename = Get_Image_Source( filename, pSettingsParser->Get_Cached( settings_file ), imgcache_dir );
+
+		if( !img_filename.empty() )
+		{
+			image_files.push_back( img_filename );
+		}
+	}
+
+	m_decode_thread = boost::thread( &cVideo::Decode_Images, this, image_files );
+}
+
+void cVideo :: Wait_Image_Decode( void )
+{
+	if( m_decode_thread.joinable() )
+	{
+		m_decode_thread.join();
+	}
+}
+
+void cVideo :: Clear_Decoded_Images( void )
+{
+	Wait_Image_Decode();
+
+	boost::mutex::scoped_lock lock( m_decoded_images_mutex );
+
+	for( DecodedImageMap::iterator itr = m_decoded_images.begin(); itr != m_decoded_images.end(); ++itr )
+	{
+		SDL_FreeSurface( itr->second );
+	}
+
+	m_decoded_images.clear();
+}
+
+std::string cVideo :: Get_Image_Source( const std::string &filename, const cImage_Settings_Data *settings, const std::string &imgcache_dir ) const
+{
+	// if a settings file exists
+	if( settings )
+	{
+		std::string settings_file = filename;
+
+		if( settings_file.rfind( ".settings" ) == std::string::npos )
+		{
+			settings_file.erase( settings_file.rfind( "." ) + 1 );
+			settings_file.insert( settings_file.rfind( "." ) + 1, "settings" );
+		}
+
+		// add cache dir and remove data dir
+		std::string img_filename_cache = imgcache_dir + "/" + settings_file.substr( strlen( DATA_DIR "/" ) ) + ".png";
+
+		// check if image cache file exists
+		if( !imgcache_dir.empty() && File_Exists( img_filename_cache ) )
+		{
+			return img_filename_cache;
+		}
+		// image given in base settings
+		else if( !settings->m_base.empty() )
+		{
+			// use current directory
+			std::string img_filename = filename.substr( 0, filename.rfind( "/" ) + 1 ) + settings->m_base;
+
+			// not found
+			if( !File_Exists( img_filename ) )
+			{
+				// use data dir
+				img_filename = settings->m_base;
+
+				// pixmaps dir must be given
+				if( img_filename.find( DATA_DIR "/" GAME_PIXMAPS_DIR "/" ) == std::string::npos )
+				{
+					img_filename.insert( 0, DATA_DIR "/" GAME_PIXMAPS_DIR "/" );
+				}
+			}
+
+			return img_filename;
+		}
+	}
+
+	// if not set in image settings and file exists
+	if( File_Exists( filename ) )
+	{
+		return filename;
+	}
+
+	return std::string();
+}
+
+SDL_Surface *cVideo :: Load_SDL_Surface( const std::string &filename ) const
+{
+	// use the surface if decoded in the background
+	{
+		boost::mutex::scoped_lock lock( m_decoded_images_mutex );
+		DecodedImageMap::iterator itr = m_decoded_images.find( filename );
+
+		if( itr != m_decoded_images.end() )
+		{
+			SDL_Surface *sdl_surface = itr->second;
+			m_decoded_images.erase( itr );
+			return sdl_surface;
+		}
+	}
+
+	return IMG_Load_RW( pResource_Manager->Open_File( filename ), 1 );
+}
+
+void cVideo :: Decode_Images( const vector<std::string> &filenames )
+{
+	for( vector<std::string>::const_iterator itr = filenames.begin(); itr != filenames.end(); ++itr )
+	{
+		const std::string &filename = (*itr);
+
+		// already decoded
+		{
+			boost::mutex::scoped_lock lock( m_decoded_images_mutex );
+
+			if( m_decoded_images.find( filename ) != m_decoded_images.end() )
+			{
+				continue;
+			}
+		}
+
+		SDL_Surface *sdl_surface = IMG_Load_RW( pResource_Manager->Open_File( filename ), 1 );
+
+		if( !sdl_surface )
+		{
+			continue;
+		}
+
+		boost::mutex::scoped_lock lock( m_decoded_images_mutex );
+
+		// the main thread could have decoded it in the meantime
+		if( !m_decoded_images.insert( DecodedImageMap::value_type( filename, sdl_surface ) ).second )
+		{
+			SDL_FreeSurface( sdl_surface );
+		}
+	}
+}
+
 cGL_Surface *cVideo :: Load_GL_Surface( std::string filename, bool use_settings /* = 1 */, bool print_errors /* = 1 */ )
 {
 	// pixmaps dir must be given
@@ -1831,6 +2124,8 @@ void cVideo :: Save_Surface( const std::string &filename, const unsigned char *d
 		return;
 	}
 
+	pResource_Manager->Set_Indexed_File( filename, 1 );
+
 	int png_color_type;
 
 	if( bpp == 4 )
@@ -1905,7 +2200,7 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 {
 	if( effect == EFFECT_OUT_RANDOM )
 	{
-		effect = static_cast<Effect_Fadeout>( ( rand() % (EFFECT_OUT_AMOUNT - 1) ) + 1 );
+		effect = static_cast<Effect_Fadeout>( Get_Random_Int( EFFECT_OUT_AMOUNT - 1, RANDOM_STREAM_VISUAL ) + 1 );
 	}
 
 	switch( effect )
@@ -1938,7 +2233,7 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 	}
 	case EFFECT_OUT_HORIZONTAL_VERTICAL:
 	{
-		int hor = ( rand() % 2 ) - 1;
+		int hor = Get_Random_Int( 2, RANDOM_STREAM_VISUAL ) - 1;
 		float pos = 0;
 		float pos_end = 0;
 
@@ -2098,7 +2393,7 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 	}
 	case EFFECT_OUT_RANDOM_COLOR_BOOST:
 	{
-		unsigned int rand_color_num = ( rand() % 4 );
+		unsigned int rand_color_num = Get_Random_Int( 4, RANDOM_STREAM_VISUAL );
 
 		Color rand_color;
 
@@ -2134,7 +2429,7 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 			{
 				// create request
 				cRect_Request *request = new cRect_Request();
-				pVideo->Draw_Rect( Get_Random_Float( -rect_size * 0.5f, game_res_w - rect_size * 0.5f ), Get_Random_Float( -rect_size * 0.5f, game_res_h - rect_size * 0.5f ), rect_size, rect_size, 0.9f, &rand_color, request );
+				pVideo->Draw_Rect( Get_Random_Float( -rect_size * 0.5f, game_res_w - rect_size * 0.5f, RANDOM_STREAM_VISUAL ), Get_Random_Float( -rect_size * 0.5f, game_res_h - rect_size * 0.5f, RANDOM_STREAM_VISUAL ), rect_size, rect_size, 0.9f, &rand_color, request );
 
 				request->m_render_count = 2;
 
@@ -2186,7 +2481,7 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 				// find an unused rect
 				while( grid[selected_tile_y][selected_tile_x] > 0.1f )
 				{
-					unsigned int temp = rand() % tiles_num;
+					unsigned int temp = Get_Random_Int( tiles_num, RANDOM_STREAM_VISUAL );
 
 					selected_tile_y = temp / tiles_num_hor;
 					selected_tile_x = temp % tiles_num_hor;
@@ -2256,7 +2551,7 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 	{
 		Color start_color;
 
-		const unsigned int rand_color = ( rand() % 2 );
+		const unsigned int rand_color = Get_Random_Int( 2, RANDOM_STREAM_VISUAL );
 
 		// green
 		if( rand_color == 0 )
@@ -2304,9 +2599,9 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 			}
 
 			// continuous random position advance
-			float random = Get_Random_Float( 2.0f, 3.0f );
+			float random = Get_Random_Float( 2.0f, 3.0f, RANDOM_STREAM_VISUAL );
 			pos_x -= random;
-			pos_y -= random + Get_Random_Float( 0.1f, 0.1f );
+			pos_y -= random + Get_Random_Float( 0.1f, 0.1f, RANDOM_STREAM_VISUAL );
 
 			// draw rects as a net
 			// horizontal
@@ -2315,8 +2610,8 @@ void Draw_Effect_Out( Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spe
 				// vertical
 				for( rect.m_y = pos_y; rect.m_y < game_res_h; rect.m_y += 20 + ( rect_size * color_mod ) )
 				{
-					rect.m_w = Get_Random_Float( 1.0f, 0.2f + ( rect_size * 1.5f ) );
-					rect.m_h = Get_Random_Float( 1.0f, 0.2f + ( rect_size * 1.5f ) );
+					rect.m_w = Get_Random_Float( 1.0f, 0.2f + ( rect_size * 1.5f ), RANDOM_STREAM_VISUAL );
+					rect.m_h = Get_Random_Float( 1.0f, 0.2f + ( rect_size * 1.5f ), RANDOM_STREAM_VISUAL );
 
 					// create request
 					cRect_Request *request = new cRect_Request();
@@ -2367,7 +2662,7 @@ void Draw_Effect_In( Effect_Fadein effect /* = EFFECT_IN_RANDOM */, float speed
 
 	if( effect == EFFECT_IN_RANDOM )
 	{
-		effect = static_cast<Effect_Fadein>( ( rand() % (EFFECT_IN_AMOUNT - 1) ) + 1 );
+		effect = static_cast<Effect_Fadein>( Get_Random_Int( EFFECT_IN_AMOUNT - 1, RANDOM_STREAM_VISUAL ) + 1 );
 	}
 
 	switch( effect )
@@ -39,6 +39,8 @@
 #include "RendererModules/OpenGL/CEGUIOpenGLRenderer.h"
 // boost thread
 #include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/unordered_map.hpp>
 
 namespace SMC
 {
@@ -131,6 +133,10 @@ public:
 	void Render( bool threaded = 0 );
 	// Finish thread rendering
 	void Render_Finish( void );
+	/* Write the frame timings and render statistics to the performance log
+	 * the log is only written while performance debugging is enabled
+	*/
+	void Update_Performance_Log( void );
 
 	// Toggle fullscreen video mode ( new mode is set to preferences )
 	void Toggle_Fullscreen( void );
@@ -161,6 +167,16 @@ public:
 	*/
 	cSoftware_Image Load_Image( std::string filename, bool load_settings = 1, bool print_errors = 1 ) const;
 
+	/* Decode the images in a background thread
+	 * filenames : images as given to Get_Surface
+	 * Load_Image uses the decoded images instead of loading them again
+	*/
+	void Start_Image_Decode( const vector<std::string> &filenames );
+	// Wait until the background decoding is finished
+	void Wait_Image_Decode( void );
+	// Wait for the background decoding and delete the unused decoded images
+	void Clear_Decoded_Images( void );
+
 	/* Load and return the hardware image
 	 * use_settings : enable file settings if set to 1
 	 * print_errors : print errors if image couldn't be created or loaded
@@ -263,7 +279,30 @@ public:
 	// rendering thread
 	boost::thread m_render_thread;
 
+	// performance log file
+	ofstream m_performance_log;
+	// frames written to the performance log
+	unsigned int m_performance_log_frame;
+	// if the performance log could not be opened
+	bool m_performance_log_failed;
+
 private:
+	/* Return the image file loaded for the filename with the settings or an empty string if not available
+	 * imgcache_dir : image cache directory or empty to use the original image
+	*/
+	std::string Get_Image_Source( const std::string &filename, const cImage_Settings_Data *settings, const std::string &imgcache_dir ) const;
+	// Load the image file or take it from the decoded images
+	SDL_Surface *Load_SDL_Surface( const std::string &filename ) const;
+	// Decode the images in the background thread
+	void Decode_Images( const vector<std::string> &filenames );
+
+	typedef boost::unordered_map<std::string, SDL_Surface *> DecodedImageMap;
+	// images decoded in the background thread by filename
+	mutable DecodedImageMap m_decoded_images;
+	mutable boost::mutex m_decoded_images_mutex;
+	// background image decoding thread
+	boost::thread m_decode_thread;
+
 	// if set video is initialized successfully
 	bool m_initialised;
 };